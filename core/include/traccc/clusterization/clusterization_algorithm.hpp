@@ -8,8 +8,6 @@
 #pragma once
 
 // Library include(s).
-#include "traccc/clusterization/measurement_creation_algorithm.hpp"
-#include "traccc/clusterization/sparse_ccl_algorithm.hpp"
 #include "traccc/edm/measurement_collection.hpp"
 #include "traccc/edm/silicon_cell_collection.hpp"
 #include "traccc/geometry/detector_conditions_description.hpp"
@@ -31,6 +29,12 @@ namespace traccc::host {
 /// This algorithm creates local/2D measurements separately for each detector
 /// module from the cells of the modules.
 ///
+/// It does the same as @c traccc::host::sparse_ccl_algorithm followed by
+/// @c traccc::host::measurement_creation_algorithm, but in a single pass
+/// over the cells. The cluster properties are accumulated right after the
+/// cells of a group of modules are labelled, without a cluster container
+/// in between.
+///
 class clusterization_algorithm
     : public algorithm<edm::measurement_collection::host(
           const edm::silicon_cell_collection::const_view&,
@@ -49,6 +53,16 @@ class clusterization_algorithm
         vecmem::memory_resource& mr,
         std::unique_ptr<const Logger> logger = getDummyLogger().clone());
 
+    /// Enable or disable the parallel processing of single events
+    ///
+    /// When enabled, and built with TBB, the cells of large events are split
+    /// into chunks of whole modules, which are processed in parallel. It is
+    /// disabled by default, in which case the algorithm does not use TBB.
+    ///
+    /// @param value Whether to process single events in parallel
+    ///
+    void set_intra_event_parallelism(bool value);
+
     /// Construct measurements for each detector module
     ///
     /// @param cells_view The cells for every detector module in the event
@@ -63,19 +77,10 @@ class clusterization_algorithm
         const override;
 
     private:
-    /// @name Sub-algorithms used by this algorithm
-    /// @{
-
-    /// Per-module cluster creation algorithm
-    sparse_ccl_algorithm m_cc;
-
-    /// Per-module measurement creation algorithm
-    measurement_creation_algorithm m_mc;
-
-    /// @}
-
     /// Reference to the host-accessible memory resource
     std::reference_wrapper<vecmem::memory_resource> m_mr;
+    /// Whether to process the cells of single events in parallel
+    bool m_intra_event_parallelism = false;
 };  // class clusterization_algorithm
 
 }  // namespace traccc::host
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2025 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -16,6 +16,9 @@
 #include "traccc/geometry/detector_conditions_description.hpp"
 #include "traccc/geometry/detector_design_description.hpp"
 
+// System include(s).
+#include <limits>
+
 namespace traccc::details {
 
 /// Get the local position of a cell on a module
@@ -30,6 +33,61 @@ TRACCC_HOST_DEVICE inline vector2 position_from_cell(
     const edm::silicon_cell<TCell>& cell,
     const traccc::detector_design_description_interface<TDesign>& module_dd);
 
+/// Properties of a cluster, accumulated cell-by-cell
+///
+/// The cells of a cluster can be added one at a time, in any pass over the
+/// cells that visits them in order. The result is the same as the one of
+/// @c calc_cluster_properties for a cluster with the same cells.
+///
+class cluster_properties {
+
+    public:
+    /// Add a cell to the cluster
+    ///
+    /// @param[in] cell      The cell to add
+    /// @param[in] module_dd The design of the module the cell is on
+    ///
+    template <typename TCell, typename TDesign>
+    TRACCC_HOST_DEVICE inline void add_cell(
+        const edm::silicon_cell<TCell>& cell,
+        const traccc::detector_design_description_interface<TDesign>&
+            module_dd);
+
+    /// Get the final properties of the cluster
+    ///
+    /// @param[in] module_dd    The design of the module the cluster is on
+    /// @param[out] mean        The mean position of the cluster/measurement
+    /// @param[out] var         The variation on the mean position of the
+    ///                         cluster/measurement
+    /// @param[out] totalWeight The total weight of the cluster/measurement
+    ///
+    template <typename TDesign>
+    TRACCC_HOST_DEVICE inline void get(
+        const traccc::detector_design_description_interface<TDesign>&
+            module_dd,
+        point2& mean, point2& var, scalar& totalWeight) const;
+
+    private:
+    /// Position of the first cell, that all positions are relative to
+    point2 m_offset{0.f, 0.f};
+    /// Running (weighted) mean of the cell positions
+    point2 m_mean{0.f, 0.f};
+    /// Running (weighted) variance of the cell positions
+    point2 m_var{0.f, 0.f};
+    /// Total weight of the cells
+    scalar m_totalWeight = 0.f;
+    /// Whether any cell was added yet
+    bool m_first_processed = false;
+    /// @name Channel range of the cells
+    /// @{
+    unsigned int m_min_channel0 = std::numeric_limits<unsigned int>::max();
+    unsigned int m_max_channel0 = std::numeric_limits<unsigned int>::lowest();
+    unsigned int m_min_channel1 = std::numeric_limits<unsigned int>::max();
+    unsigned int m_max_channel1 = std::numeric_limits<unsigned int>::lowest();
+    /// @}
+
+};  // class cluster_properties
+
 /// Function used for calculating the properties of the cluster during
 /// measurement creation
 ///
@@ -66,6 +124,23 @@ TRACCC_HOST_DEVICE inline void fill_measurement(
     const detector_design_description::const_device& det_descr,
     const detector_conditions_description::const_device& det_cond);
 
+/// Function filling a measurement from the properties of its cluster
+///
+/// @param[out] measurement Measurement object to be filled
+/// @param[in] properties   The accumulated properties of the cluster
+/// @param[in] index        The index of the cluster/measurement in the
+///                         collection
+/// @param[in] module_cd    Conditions of the module the cluster is on
+/// @param[in] module_dd    Design of the module the cluster is on
+///
+template <typename T, typename TConditions, typename TDesign>
+TRACCC_HOST_DEVICE inline void fill_measurement(
+    edm::measurement<T>& measurement, const cluster_properties& properties,
+    unsigned int index,
+    const traccc::detector_conditions_description_interface<TConditions>&
+        module_cd,
+    const traccc::detector_design_description_interface<TDesign>& module_dd);
+
 }  // namespace traccc::details
 
 // Include the implementation.
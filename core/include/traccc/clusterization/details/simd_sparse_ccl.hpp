@@ -0,0 +1,55 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/silicon_cell_collection.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+
+namespace traccc::host::details {
+
+/// Implementations of the adjacency scan of @c simd_sparse_ccl
+enum class sparse_ccl_scan {
+    /// The fastest implementation supported by the current CPU
+    automatic,
+    /// Scalar implementation, available on all CPUs
+    scalar,
+    /// AVX2 implementation, comparing 8 cells at a time
+    avx2,
+    /// AVX-512 implementation, comparing 16 cells at a time
+    avx512
+};
+
+/// SparseCCL on a contiguous range of cells, with a vectorised adjacency scan
+///
+/// It produces exactly the same labels as @c traccc::details::sparse_ccl.
+/// But it compares every cell with a block of its candidate neighbours at
+/// once, using AVX-512 or AVX2 if the CPU supports them. On other CPUs it
+/// falls back to the scalar implementation.
+///
+/// A specific implementation may be requested for testing purposes. It is
+/// up to the caller to make sure that the CPU supports it. Requesting an
+/// implementation that was not compiled into the library throws
+/// @c std::invalid_argument.
+///
+/// @param cells  The cell collection
+/// @param labels The vector of the output indices (to which cluster a cell
+///               belongs to)
+/// @param begin  The index of the first cell to label
+/// @param end    The index after the last cell to label
+/// @param scan   The implementation of the adjacency scan to use
+/// @return The number of clusters in the range
+///
+unsigned int simd_sparse_ccl(
+    const edm::silicon_cell_collection::const_device& cells,
+    vecmem::device_vector<unsigned int>& labels, unsigned int begin,
+    unsigned int end, sparse_ccl_scan scan = sparse_ccl_scan::automatic);
+
+}  // namespace traccc::host::details
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2024 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -76,6 +76,24 @@ TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
     const edm::silicon_cell_collection::const_device& cells,
     vecmem::device_vector<unsigned int>& labels);
 
+/// Sparce CCL algorithm on a contiguous range of cells
+///
+/// The range must not split the cells of any module between itself and
+/// the rest of the collection. Only the labels of the cells in the range
+/// are set, with the clusters of the range numbered from zero.
+///
+/// @param cells is the cell collection
+/// @param labels is the vector of the output indices (to which cluster a cell
+///               belongs to)
+/// @param begin is the index of the first cell to label
+/// @param end is the index after the last cell to label
+/// @return number of clusters in the range
+///
+TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
+    const edm::silicon_cell_collection::const_device& cells,
+    vecmem::device_vector<unsigned int>& labels, unsigned int begin,
+    unsigned int end);
+
 }  // namespace traccc::details
 
 // Include the implementation.
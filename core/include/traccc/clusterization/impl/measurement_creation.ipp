@@ -35,80 +35,85 @@ TRACCC_HOST_DEVICE inline vector2 position_from_cell(
     return cell_middle_position;
 }
 
-template <typename T, typename TDesign>
-TRACCC_HOST_DEVICE inline void calc_cluster_properties(
-    const edm::silicon_cluster<T>& cluster,
-    const edm::silicon_cell_collection::const_device& cells,
-    const traccc::detector_design_description_interface<TDesign>& module_dd,
-    point2& mean, point2& var, scalar& totalWeight) {
-
-    point2 offset{0.f, 0.f}, width{0.f, 0.f};
-    bool first_processed = false;
-
-    unsigned int min_channel0 = std::numeric_limits<unsigned int>::max();
-    unsigned int max_channel0 = std::numeric_limits<unsigned int>::lowest();
-    unsigned int min_channel1 = std::numeric_limits<unsigned int>::max();
-    unsigned int max_channel1 = std::numeric_limits<unsigned int>::lowest();
-
-    // Loop over the cell indices of the cluster.
-    for (const unsigned int cell_idx : cluster.cell_indices()) {
+template <typename TCell, typename TDesign>
+TRACCC_HOST_DEVICE inline void cluster_properties::add_cell(
+    const edm::silicon_cell<TCell>& cell,
+    const traccc::detector_design_description_interface<TDesign>& module_dd) {
 
-        // The cell object.
-        const edm::silicon_cell cell = cells.at(cell_idx);
+    // Translate the cell readout value into a weight.
+    const scalar weight = cell.activation();
 
-        // Translate the cell readout value into a weight.
-        const scalar weight = cell.activation();
+    // Update all output properties with this cell.
+    m_totalWeight += weight;
+    scalar weight_factor = weight / m_totalWeight;
 
-        // Update all output properties with this cell.
-        totalWeight += weight;
-        scalar weight_factor = weight / totalWeight;
+    point2 cell_position = position_from_cell(cell, module_dd);
 
-        point2 cell_position = position_from_cell(cell, module_dd);
+    m_min_channel0 = std::min(m_min_channel0, cell.channel0());
+    m_min_channel1 = std::min(m_min_channel1, cell.channel1());
+    m_max_channel0 = std::max(m_max_channel0, cell.channel0());
+    m_max_channel1 = std::max(m_max_channel1, cell.channel1());
 
-        min_channel0 = std::min(min_channel0, cell.channel0());
-        min_channel1 = std::min(min_channel1, cell.channel1());
-        max_channel0 = std::max(max_channel0, cell.channel0());
-        max_channel1 = std::max(max_channel1, cell.channel1());
+    if (!m_first_processed) {
+        m_offset = cell_position;
+        m_first_processed = true;
+    }
 
-        if (!first_processed) {
-            offset = cell_position;
-            first_processed = true;
-        }
+    cell_position = cell_position - m_offset;
 
-        cell_position = cell_position - offset;
+    const point2 diff_old = cell_position - m_mean;
+    m_mean = m_mean + diff_old * weight_factor;
+    const point2 diff_new = cell_position - m_mean;
 
-        const point2 diff_old = cell_position - mean;
-        mean = mean + diff_old * weight_factor;
-        const point2 diff_new = cell_position - mean;
+    m_var[0] = (1.f - weight_factor) * m_var[0] +
+               weight_factor * (diff_old[0] * diff_new[0]);
+    m_var[1] = (1.f - weight_factor) * m_var[1] +
+               weight_factor * (diff_old[1] * diff_new[1]);
+}
 
-        var[0] = (1.f - weight_factor) * var[0] +
-                 weight_factor * (diff_old[0] * diff_new[0]);
-        var[1] = (1.f - weight_factor) * var[1] +
-                 weight_factor * (diff_old[1] * diff_new[1]);
-    }
+template <typename TDesign>
+TRACCC_HOST_DEVICE inline void cluster_properties::get(
+    const traccc::detector_design_description_interface<TDesign>& module_dd,
+    point2& mean, point2& var, scalar& totalWeight) const {
 
     // cluster width in the number of cells
-    unsigned int delta0 = (max_channel0 - min_channel0) + 1;
-    unsigned int delta1 = (max_channel1 - min_channel1) + 1;
+    unsigned int delta0 = (m_max_channel0 - m_min_channel0) + 1;
+    unsigned int delta1 = (m_max_channel1 - m_min_channel1) + 1;
 
     vector2 cluster_lower_position = {
-        (module_dd.bin_edges_x()).at(min_channel0),
-        (module_dd.bin_edges_y()).at(min_channel1)};
+        (module_dd.bin_edges_x()).at(m_min_channel0),
+        (module_dd.bin_edges_y()).at(m_min_channel1)};
 
     vector2 cluster_upper_position = {
-        (module_dd.bin_edges_x()).at(max_channel0 + 1),
-        (module_dd.bin_edges_y()).at(max_channel1 + 1)};
+        (module_dd.bin_edges_x()).at(m_max_channel0 + 1),
+        (module_dd.bin_edges_y()).at(m_max_channel1 + 1)};
 
-    width[0] = cluster_upper_position[0] - cluster_lower_position[0];
-    width[1] = cluster_upper_position[1] - cluster_lower_position[1];
+    const point2 width{cluster_upper_position[0] - cluster_lower_position[0],
+                       cluster_upper_position[1] - cluster_lower_position[1]};
 
     point2 pitch = {width[0] / static_cast<float>(delta0),
                     width[1] / static_cast<float>(delta1)};
 
-    var = var + point2{pitch[0] * pitch[0] / static_cast<scalar>(12.),
-                       pitch[1] * pitch[1] / static_cast<scalar>(12.)};
+    var = m_var + point2{pitch[0] * pitch[0] / static_cast<scalar>(12.),
+                         pitch[1] * pitch[1] / static_cast<scalar>(12.)};
 
-    mean = mean + offset;
+    mean = m_mean + m_offset;
+    totalWeight = m_totalWeight;
+}
+
+template <typename T, typename TDesign>
+TRACCC_HOST_DEVICE inline void calc_cluster_properties(
+    const edm::silicon_cluster<T>& cluster,
+    const edm::silicon_cell_collection::const_device& cells,
+    const traccc::detector_design_description_interface<TDesign>& module_dd,
+    point2& mean, point2& var, scalar& totalWeight) {
+
+    // Loop over the cell indices of the cluster.
+    cluster_properties properties;
+    for (const unsigned int cell_idx : cluster.cell_indices()) {
+        properties.add_cell(cells.at(cell_idx), module_dd);
+    }
+    properties.get(module_dd, mean, var, totalWeight);
 }
 
 template <typename T1, typename T2>
@@ -150,9 +155,27 @@ TRACCC_HOST_DEVICE inline void fill_measurement(
     const auto module_dd = det_descr.at(design_idx);
 
     // Calculate the cluster properties
+    cluster_properties properties;
+    for (const unsigned int cell_idx : cluster.cell_indices()) {
+        properties.add_cell(cells.at(cell_idx), module_dd);
+    }
+
+    // Fill the measurement object.
+    fill_measurement(measurement, properties, index, module_cd, module_dd);
+}
+
+template <typename T, typename TConditions, typename TDesign>
+TRACCC_HOST_DEVICE inline void fill_measurement(
+    edm::measurement<T>& measurement, const cluster_properties& properties,
+    const unsigned int index,
+    const traccc::detector_conditions_description_interface<TConditions>&
+        module_cd,
+    const traccc::detector_design_description_interface<TDesign>& module_dd) {
+
+    // Get the final cluster properties
     scalar totalWeight = 0.f;
     point2 mean{0.f, 0.f}, var{0.f, 0.f};
-    calc_cluster_properties(cluster, cells, module_dd, mean, var, totalWeight);
+    properties.get(module_dd, mean, var, totalWeight);
     assert(totalWeight > 0.f);
 
     // Fill the measurement object.
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2024 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -64,14 +64,22 @@ TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
     const edm::silicon_cell_collection::const_device& cells,
     vecmem::device_vector<unsigned int>& labels) {
 
-    unsigned int nlabels = 0;
+    return sparse_ccl(cells, labels, 0u, cells.size());
+}
 
-    // The number of cells.
-    const unsigned int n_cells = cells.size();
+TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
+    const edm::silicon_cell_collection::const_device& cells,
+    vecmem::device_vector<unsigned int>& labels, unsigned int begin,
+    unsigned int end) {
+
+    assert(begin <= end);
+    assert(end <= cells.size());
+
+    unsigned int nlabels = 0;
 
     // first scan: pixel association
-    unsigned int start_j = 0;
-    for (unsigned int i = 0; i < n_cells; ++i) {
+    unsigned int start_j = begin;
+    for (unsigned int i = begin; i < end; ++i) {
 
         labels[i] = i;
         unsigned int ai = i;
@@ -86,7 +94,7 @@ TRACCC_HOST_DEVICE inline unsigned int sparse_ccl(
     }
 
     // second scan: transitive closure
-    for (unsigned int i = 0; i < n_cells; ++i) {
+    for (unsigned int i = begin; i < end; ++i) {
         if (labels[i] == i) {
             labels[i] = nlabels++;
         } else {
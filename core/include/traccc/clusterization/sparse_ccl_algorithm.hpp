@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2024 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -27,8 +27,16 @@ namespace traccc::host {
 /// The implementation is based on the paper:
 /// https://doi.org/10.1109/DASIP48288.2019.9049184
 ///
+/// The clusters are returned in a fixed size buffer, which holds the cell
+/// indices of all clusters in one contiguous array, without a separate
+/// allocation for every cluster.
+///
+/// When built with TBB, the cells of large events can be split into chunks of
+/// whole modules, which are labelled in parallel. See
+/// @c set_intra_event_parallelism.
+///
 class sparse_ccl_algorithm
-    : public algorithm<edm::silicon_cluster_collection::host(
+    : public algorithm<edm::silicon_cluster_collection::buffer(
           const edm::silicon_cell_collection::const_view&,
           const detector_conditions_description::const_view& det_cond_view)>,
       public messaging {
@@ -42,6 +50,16 @@ class sparse_ccl_algorithm
         vecmem::memory_resource& mr,
         std::unique_ptr<const Logger> logger = getDummyLogger().clone());
 
+    /// Enable or disable the parallel processing of single events
+    ///
+    /// When enabled, and built with TBB, the cells of large events are split
+    /// into chunks of whole modules, which are labelled in parallel. It is
+    /// disabled by default, in which case the algorithm does not use TBB.
+    ///
+    /// @param value Whether to process single events in parallel
+    ///
+    void set_intra_event_parallelism(bool value);
+
     /// @name Operator(s) to use in host code
     /// @{
 
@@ -50,7 +68,7 @@ class sparse_ccl_algorithm
     /// @param cells_view Collection of input cells sorted by module
     /// @param det_cond_view Collection of detector conditions
     ///
-    /// @return a cluster container
+    /// @return a cluster buffer, in host accessible memory
     ///
     output_type operator()(
         const edm::silicon_cell_collection::const_view& cells_view,
@@ -62,6 +80,8 @@ class sparse_ccl_algorithm
     private:
     /// The memory resource used by the algorithm
     std::reference_wrapper<vecmem::memory_resource> m_mr;
+    /// Whether to process the cells of single events in parallel
+    bool m_intra_event_parallelism = false;
 };  // class sparse_ccl_algorithm
 
 }  // namespace traccc::host
@@ -0,0 +1,75 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+namespace traccc {
+
+/// Stable LSD radix sort of a vector by an unsigned integer key
+///
+/// The elements are sorted byte-by-byte, starting with the least
+/// significant byte of the key. Bytes that are the same for all elements
+/// are skipped. Since the sort is stable, sorting by multiple keys can be
+/// done by calling this function for each key, starting with the least
+/// significant one.
+///
+/// @param values The elements to sort
+/// @param key    Function returning the (unsigned integer) key of an element
+///
+template <typename T, typename ALLOC, typename KEY>
+void radix_sort(std::vector<T, ALLOC>& values, const KEY& key) {
+
+    using key_type =
+        std::remove_cvref_t<std::invoke_result_t<const KEY&, const T&>>;
+    static_assert(std::is_unsigned_v<key_type>,
+                  "The sorting key must be an unsigned integer.");
+    static constexpr std::size_t N_DIGITS = sizeof(key_type);
+    static constexpr std::size_t N_BUCKETS = 256u;
+
+    // Count the occurrences of each value of each byte, in a single pass.
+    std::array<std::array<std::size_t, N_BUCKETS>, N_DIGITS> counts{};
+    for (const T& value : values) {
+        const key_type k = std::invoke(key, value);
+        for (std::size_t digit = 0; digit < N_DIGITS; ++digit) {
+            ++(counts[digit][(k >> (8u * digit)) & 0xffu]);
+        }
+    }
+
+    // Sort by each byte that is not the same for all elements.
+    std::vector<T, ALLOC> buffer(values.size(), values.get_allocator());
+    for (std::size_t digit = 0; digit < N_DIGITS; ++digit) {
+
+        std::array<std::size_t, N_BUCKETS>& offsets = counts[digit];
+        if (std::any_of(offsets.begin(), offsets.end(),
+                        [n = values.size()](std::size_t count) {
+                            return count == n;
+                        })) {
+            continue;
+        }
+        std::size_t offset = 0u;
+        for (std::size_t& count : offsets) {
+            const std::size_t bucket_size = count;
+            count = offset;
+            offset += bucket_size;
+        }
+        for (const T& value : values) {
+            const key_type k = std::invoke(key, value);
+            buffer[offsets[(k >> (8u * digit)) & 0xffu]++] = value;
+        }
+        values.swap(buffer);
+    }
+}
+
+}  // namespace traccc
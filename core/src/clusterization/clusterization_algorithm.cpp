@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,24 +8,129 @@
 // Library include(s).
 #include "traccc/clusterization/clusterization_algorithm.hpp"
 
+#include "traccc/clusterization/details/measurement_creation.hpp"
+#include "traccc/clusterization/details/simd_sparse_ccl.hpp"
+#include "traccc/sanity/contiguous_on.hpp"
+#include "traccc/sanity/ordered_on.hpp"
+#include "traccc/utils/projections.hpp"
+#include "traccc/utils/relations.hpp"
+
+// Local include(s).
+#include "module_chunks.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+
+// System include(s).
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
 namespace traccc::host {
+namespace {
+
+/// The clusters found in one chunk of cells
+struct chunk_clusters {
+    /// The accumulated properties of the clusters
+    std::vector<traccc::details::cluster_properties> properties;
+    /// The index of the module that each cluster is on
+    std::vector<unsigned int> modules;
+};
+
+}  // namespace
 
 clusterization_algorithm::clusterization_algorithm(
     vecmem::memory_resource& mr, std::unique_ptr<const Logger> logger)
-    : messaging(logger->clone()),
-      m_cc(mr, logger->cloneWithSuffix("CclAlg")),
-      m_mc(mr, logger->cloneWithSuffix("MeasurementCreationAlg")),
-      m_mr(mr) {}
+    : messaging(std::move(logger)), m_mr(mr) {}
+
+void clusterization_algorithm::set_intra_event_parallelism(bool value) {
+
+    m_intra_event_parallelism = value;
+}
 
 clusterization_algorithm::output_type clusterization_algorithm::operator()(
     const edm::silicon_cell_collection::const_view& cells_view,
     const detector_design_description::const_view& dmd_view,
     const detector_conditions_description::const_view& dcd_view) const {
 
-    const sparse_ccl_algorithm::output_type clusters =
-        m_cc(cells_view, dcd_view);
-    const auto clusters_data = vecmem::get_data(clusters);
-    return m_mc(cells_view, clusters_data, dmd_view, dcd_view);
+    // Create device containers for the input variables.
+    const edm::silicon_cell_collection::const_device cells{cells_view};
+    const detector_design_description::const_device det_descr{dmd_view};
+    const detector_conditions_description::const_device det_cond{dcd_view};
+
+    // Run some sanity checks on the cells.
+    assert(is_contiguous_on(cell_module_projection(), cells));
+    assert(is_ordered_on(channel0_major_cell_order_relation(), cells));
+
+    // Split the cells into chunks of whole modules, which can be processed
+    // independently of each other. (If intra-event parallelism is enabled.
+    // Otherwise all cells end up in a single chunk.)
+    const std::vector<unsigned int> chunks =
+        details::module_aligned_chunks(cells, m_intra_event_parallelism);
+    const std::size_t n_chunks = chunks.size() - 1u;
+
+    // Label the cells of each chunk, and right away accumulate the properties
+    // of the clusters found in it. The per-cluster state is allocated with
+    // the default allocator, as the memory resource of the algorithm may not
+    // be usable from multiple threads.
+    vecmem::vector<unsigned int> cluster_indices{cells.size(), &(m_mr.get())};
+    vecmem::device_vector<unsigned int> cluster_indices_device{
+        vecmem::get_data(cluster_indices)};
+    std::vector<chunk_clusters> clusters(n_chunks);
+    details::for_each_chunk(n_chunks, [&](std::size_t i) {
+        const unsigned int n_clusters = details::simd_sparse_ccl(
+            cells, cluster_indices_device, chunks[i], chunks[i + 1]);
+        chunk_clusters& result = clusters[i];
+        result.properties.resize(n_clusters);
+        result.modules.resize(n_clusters);
+
+        // Visit the cells in order, so that the cells of every cluster would
+        // be added in the same order as by the measurement creation
+        // algorithm.
+        unsigned int module_idx = std::numeric_limits<unsigned int>::max();
+        unsigned int design_idx = 0u;
+        for (unsigned int cell_idx = chunks[i]; cell_idx < chunks[i + 1];
+             ++cell_idx) {
+            const edm::silicon_cell cell = cells.at(cell_idx);
+            if (cell.module_index() != module_idx) {
+                module_idx = cell.module_index();
+                design_idx = det_cond.at(module_idx).module_to_design_id();
+            }
+            const unsigned int cluster_idx = cluster_indices[cell_idx];
+            result.properties[cluster_idx].add_cell(cell,
+                                                    det_descr.at(design_idx));
+            result.modules[cluster_idx] = module_idx;
+        }
+    });
+
+    // Calculate where the measurements of each chunk start in the output.
+    std::vector<unsigned int> offsets(n_chunks + 1u, 0u);
+    for (std::size_t i = 0; i < n_chunks; ++i) {
+        offsets[i + 1] = offsets[i] + static_cast<unsigned int>(
+                                          clusters[i].properties.size());
+    }
+
+    // Create the result object.
+    output_type result(m_mr.get());
+    result.resize(offsets.back());
+    edm::measurement_collection::device measurements{vecmem::get_data(result)};
+
+    // Fill the measurements of each chunk.
+    details::for_each_chunk(n_chunks, [&](std::size_t i) {
+        const chunk_clusters& chunk = clusters[i];
+        for (unsigned int j = 0; j < chunk.properties.size(); ++j) {
+            const unsigned int index = offsets[i] + j;
+            edm::measurement measurement = measurements.at(index);
+            const auto module_cd = det_cond.at(chunk.modules[j]);
+            traccc::details::fill_measurement(
+                measurement, chunk.properties[j], index, module_cd,
+                det_descr.at(module_cd.module_to_design_id()));
+        }
+    });
+
+    return result;
 }
 
 }  // namespace traccc::host
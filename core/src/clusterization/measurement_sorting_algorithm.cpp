@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2024-2025 CERN for the benefit of the ACTS project
+ * (c) 2024-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,11 +8,52 @@
 // Library include(s).
 #include "traccc/clusterization/measurement_sorting_algorithm.hpp"
 
+// Project include(s).
+#include "traccc/utils/radix_sort.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/vector.hpp>
+
 // System include(s).
-#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <numeric>
 
 namespace traccc::host {
+namespace {
+
+/// Unsigned integer key, ordered the same way as a floating point value
+///
+/// Positive values get their sign bit set, negative ones get all their bits
+/// flipped. Negative and positive zero are given the same key, as they
+/// compare equal. (NaNs end up at the two ends of the ordering.)
+///
+/// @param value The floating point value
+/// @return The sorting key of the value
+///
+std::uint32_t float_key(float value) {
+
+    const auto bits = std::bit_cast<std::uint32_t>(value == 0.f ? 0.f : value);
+    return ((bits & 0x80000000u) ? ~bits : (bits | 0x80000000u));
+}
+
+/// Copy the elements of an input column into an output column, in a new order
+///
+/// @param output  The output column, already of the right size
+/// @param input   The input column
+/// @param indices The input index of every output element
+///
+template <typename OUTPUT, typename INPUT>
+void gather(OUTPUT& output, const INPUT& input,
+            const vecmem::vector<unsigned int>& indices) {
+
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+        output[i] = input[indices[i]];
+    }
+}
+
+}  // namespace
 
 measurement_sorting_algorithm::measurement_sorting_algorithm(
     vecmem::memory_resource& mr, std::unique_ptr<const Logger> logger)
@@ -25,22 +66,45 @@ measurement_sorting_algorithm::operator()(
     // Create a device container on top of the view.
     const edm::measurement_collection::const_device measurements{
         measurements_view};
+    const unsigned int n_measurements = measurements.size();
 
     // Create a vector of measurement indices, which would be sorted.
-    vecmem::vector<unsigned int> indices(measurements.size(), &(m_mr.get()));
+    vecmem::vector<unsigned int> indices(n_measurements, &(m_mr.get()));
     std::iota(indices.begin(), indices.end(), 0u);
 
-    // Sort the indices according to the measurements.
-    std::sort(indices.begin(), indices.end(),
-              [&](unsigned int lhs, unsigned int rhs) {
-                  return measurements.at(lhs) < measurements.at(rhs);
-              });
+    // Sort the indices by the same keys that the measurements are compared
+    // by, starting with the least significant one. The keys are extracted
+    // into a contiguous vector before each pass.
+    vecmem::vector<std::uint32_t> float_keys(n_measurements, &(m_mr.get()));
+    const auto sort_by_float = [&](const auto& column, std::size_t element) {
+        for (unsigned int i = 0; i < n_measurements; ++i) {
+            float_keys[i] = float_key(column[i][element]);
+        }
+        radix_sort(indices, [&](unsigned int i) { return float_keys[i]; });
+    };
+    sort_by_float(measurements.local_variance(), 1u);
+    sort_by_float(measurements.local_variance(), 0u);
+    sort_by_float(measurements.local_position(), 1u);
+    sort_by_float(measurements.local_position(), 0u);
+    vecmem::vector<std::uint64_t> surface_keys(n_measurements, &(m_mr.get()));
+    for (unsigned int i = 0; i < n_measurements; ++i) {
+        surface_keys[i] = measurements.surface_link()[i].value();
+    }
+    radix_sort(indices, [&](unsigned int i) { return surface_keys[i]; });
 
-    // Fill an output container with the sorted measurements.
+    // Fill an output container with the sorted measurements, one column at a
+    // time.
     edm::measurement_collection::host result{m_mr.get()};
-    for (unsigned int i : indices) {
-        result.push_back(measurements.at(i));
-    }
+    result.resize(n_measurements);
+    gather(result.local_position(), measurements.local_position(), indices);
+    gather(result.local_variance(), measurements.local_variance(), indices);
+    gather(result.dimensions(), measurements.dimensions(), indices);
+    gather(result.time(), measurements.time(), indices);
+    gather(result.diameter(), measurements.diameter(), indices);
+    gather(result.identifier(), measurements.identifier(), indices);
+    gather(result.surface_link(), measurements.surface_link(), indices);
+    gather(result.subspace(), measurements.subspace(), indices);
+    gather(result.cluster_index(), measurements.cluster_index(), indices);
 
     // Return the sorted measurements.
     return result;
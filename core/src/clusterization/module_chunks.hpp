@@ -0,0 +1,109 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/silicon_cell_collection.hpp"
+
+// TBB include(s).
+#if defined(TRACCC_HAVE_TBB)
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace traccc::host::details {
+
+/// The smallest number of cells worth processing in a separate task
+inline constexpr unsigned int min_cells_per_chunk = 4096u;
+
+/// Split the cells of an event into chunks for parallel processing
+///
+/// Chunks hold about the same number of cells, but never split a module.
+/// Without TBB, for small events, or if parallel processing was not asked
+/// for, a single chunk is made.
+///
+/// @param cells    The cells of an event, contiguous in their module index
+/// @param parallel Whether the chunks are meant to be processed in parallel
+/// @return The chunk boundaries, from 0 to the number of cells
+///
+inline std::vector<unsigned int> module_aligned_chunks(
+    const edm::silicon_cell_collection::const_device& cells,
+    [[maybe_unused]] bool parallel) {
+
+    const unsigned int n_cells = cells.size();
+    unsigned int max_chunks = 1u;
+#if defined(TRACCC_HAVE_TBB)
+    if (parallel) {
+        max_chunks = std::max(
+            1u, std::min(static_cast<unsigned int>(
+                             tbb::this_task_arena::max_concurrency()),
+                         n_cells / min_cells_per_chunk));
+    }
+#endif
+    const unsigned int chunk_size = (n_cells + max_chunks - 1) / max_chunks;
+    const auto& module_index = cells.module_index();
+
+    std::vector<unsigned int> result{0u};
+    for (unsigned int next = chunk_size; next < n_cells; next += chunk_size) {
+        // Move the boundary forward to the first cell of the next module.
+        while ((next < n_cells) &&
+               (module_index[next] == module_index[next - 1])) {
+            ++next;
+        }
+        if (next >= n_cells) {
+            break;
+        }
+        result.push_back(next);
+    }
+    result.push_back(n_cells);
+    return result;
+}
+
+/// Process a number of chunks, in parallel if TBB is available
+///
+/// The tasks are isolated, so that the waiting thread could not pick up
+/// unrelated work in the meantime. A single chunk is processed in the calling
+/// thread, without using TBB.
+///
+/// @param n_chunks The number of chunks to process
+/// @param func     Function processing one chunk, receiving its index
+///
+template <typename FUNCTION>
+void for_each_chunk(std::size_t n_chunks, const FUNCTION& func) {
+
+#if defined(TRACCC_HAVE_TBB)
+    if (n_chunks > 1u) {
+        tbb::this_task_arena::isolate([&]() {
+            tbb::parallel_for(
+                tbb::blocked_range<std::size_t>{0u, n_chunks, 1u},
+                [&](const tbb::blocked_range<std::size_t>& range) {
+                    for (std::size_t i = range.begin(); i != range.end();
+                         ++i) {
+                        func(i);
+                    }
+                });
+        });
+    } else {
+        for (std::size_t i = 0; i < n_chunks; ++i) {
+            func(i);
+        }
+    }
+#else
+    for (std::size_t i = 0; i < n_chunks; ++i) {
+        func(i);
+    }
+#endif
+}
+
+}  // namespace traccc::host::details
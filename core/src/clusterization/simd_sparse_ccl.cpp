@@ -0,0 +1,290 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/clusterization/details/simd_sparse_ccl.hpp"
+
+#include "traccc/clusterization/details/sparse_ccl.hpp"
+
+// System include(s).
+#include <bit>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+// The vectorised implementations need x86 intrinsics and function level
+// target attributes.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define TRACCC_X86_SIMD_SPARSE_CCL
+#include <immintrin.h>
+#endif
+
+namespace traccc::host::details {
+namespace {
+
+// The vectorised code loads the columns of the cells as 32-bit integers.
+static_assert(sizeof(channel_id) == sizeof(int));
+static_assert(std::is_unsigned_v<channel_id>);
+
+/// Merge cell @c i's cluster with the clusters of the adjacent candidates
+///
+/// @param labels The equivalence table
+/// @param mask   Mask of the adjacent candidates, relative to @c j
+/// @param j      Index of the first candidate of the block
+/// @param ai     The current root of cell @c i
+///
+inline void merge_adjacent(vecmem::device_vector<unsigned int>& labels,
+                           unsigned int mask, unsigned int j,
+                           unsigned int& ai) {
+
+    while (mask != 0u) {
+        const auto k = static_cast<unsigned int>(std::countr_zero(mask));
+        ai = traccc::details::make_union(
+            labels, ai, traccc::details::find_root(labels, j + k));
+        mask &= mask - 1u;
+    }
+}
+
+/// Scalar scan of the candidate neighbours of a cell
+///
+/// @param cells   The cell collection
+/// @param labels  The equivalence table
+/// @param i       Index of the cell being labelled
+/// @param start_j Index of the first candidate neighbour
+/// @param ai      The current root of cell @c i
+/// @return The number of candidates that no later cell can be adjacent to
+///
+unsigned int scan_scalar(
+    const edm::silicon_cell_collection::const_device& cells,
+    vecmem::device_vector<unsigned int>& labels, unsigned int i,
+    unsigned int start_j, unsigned int& ai) {
+
+    unsigned int n_far = 0u;
+    for (unsigned int j = start_j; j < i; ++j) {
+        if (traccc::details::is_adjacent(cells.at(i), cells.at(j))) {
+            ai = traccc::details::make_union(
+                labels, ai, traccc::details::find_root(labels, j));
+        } else if (traccc::details::is_far_enough(cells.at(i), cells.at(j))) {
+            ++n_far;
+        }
+    }
+    return n_far;
+}
+
+#if defined(TRACCC_X86_SIMD_SPARSE_CCL)
+
+/// AVX2 scan of the candidate neighbours of a cell, 8 at a time
+///
+/// It uses the same (wrapping) unsigned arithmetic as
+/// @c traccc::details::is_adjacent and @c traccc::details::is_far_enough.
+///
+__attribute__((target("avx2"))) unsigned int scan_avx2(
+    const edm::silicon_cell_collection::const_device& cells,
+    vecmem::device_vector<unsigned int>& labels, unsigned int i,
+    unsigned int start_j, unsigned int& ai) {
+
+    const unsigned int* channel0 = cells.channel0().data();
+    const unsigned int* channel1 = cells.channel1().data();
+    const unsigned int* module_index = cells.module_index().data();
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i all = _mm256_set1_epi32(-1);
+    const __m256i sign = _mm256_set1_epi32(std::numeric_limits<int>::min());
+    const __m256i channel0_i =
+        _mm256_set1_epi32(static_cast<int>(channel0[i]));
+    const __m256i channel1_i =
+        _mm256_set1_epi32(static_cast<int>(channel1[i]));
+    const __m256i module_i =
+        _mm256_set1_epi32(static_cast<int>(module_index[i]));
+
+    unsigned int n_far = 0u;
+    unsigned int j = start_j;
+    for (; j + 8u <= i; j += 8u) {
+
+        const __m256i channel0_j = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(channel0 + j));
+        const __m256i channel1_j = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(channel1 + j));
+        const __m256i module_j = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(module_index + j));
+
+        // (a - b) * (a - b) <= 1, for both channels, on the same module.
+        const __m256i d0 = _mm256_sub_epi32(channel0_i, channel0_j);
+        const __m256i d1 = _mm256_sub_epi32(channel1_i, channel1_j);
+        const __m256i close0 = _mm256_cmpeq_epi32(
+            _mm256_andnot_si256(one, _mm256_mullo_epi32(d0, d0)), zero);
+        const __m256i close1 = _mm256_cmpeq_epi32(
+            _mm256_andnot_si256(one, _mm256_mullo_epi32(d1, d1)), zero);
+        const __m256i same_module = _mm256_cmpeq_epi32(module_i, module_j);
+        const __m256i adjacent =
+            _mm256_and_si256(_mm256_and_si256(close0, close1), same_module);
+
+        // a.channel1() > b.channel1() + 1, or different modules. The unsigned
+        // comparison is done as a signed one, with flipped sign bits.
+        const __m256i far_channel1 = _mm256_cmpgt_epi32(
+            _mm256_xor_si256(channel1_i, sign),
+            _mm256_xor_si256(_mm256_add_epi32(channel1_j, one), sign));
+        const __m256i far = _mm256_or_si256(
+            far_channel1, _mm256_andnot_si256(same_module, all));
+
+        const auto adjacent_mask = static_cast<unsigned int>(
+            _mm256_movemask_ps(_mm256_castsi256_ps(adjacent)));
+        const auto far_mask =
+            static_cast<unsigned int>(
+                _mm256_movemask_ps(_mm256_castsi256_ps(far))) &
+            ~adjacent_mask;
+
+        n_far += static_cast<unsigned int>(std::popcount(far_mask));
+        merge_adjacent(labels, adjacent_mask, j, ai);
+    }
+
+    // Process the remaining candidates one-by-one.
+    return n_far + scan_scalar(cells, labels, i, j, ai);
+}
+
+/// AVX-512 scan of the candidate neighbours of a cell, 16 at a time
+///
+/// It uses the same (wrapping) unsigned arithmetic as
+/// @c traccc::details::is_adjacent and @c traccc::details::is_far_enough.
+///
+__attribute__((target("avx512f"))) unsigned int scan_avx512(
+    const edm::silicon_cell_collection::const_device& cells,
+    vecmem::device_vector<unsigned int>& labels, unsigned int i,
+    unsigned int start_j, unsigned int& ai) {
+
+    const unsigned int* channel0 = cells.channel0().data();
+    const unsigned int* channel1 = cells.channel1().data();
+    const unsigned int* module_index = cells.module_index().data();
+
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i channel0_i =
+        _mm512_set1_epi32(static_cast<int>(channel0[i]));
+    const __m512i channel1_i =
+        _mm512_set1_epi32(static_cast<int>(channel1[i]));
+    const __m512i module_i =
+        _mm512_set1_epi32(static_cast<int>(module_index[i]));
+
+    unsigned int n_far = 0u;
+    unsigned int j = start_j;
+    for (; j + 16u <= i; j += 16u) {
+
+        const __m512i channel0_j = _mm512_loadu_si512(channel0 + j);
+        const __m512i channel1_j = _mm512_loadu_si512(channel1 + j);
+        const __m512i module_j = _mm512_loadu_si512(module_index + j);
+
+        // (a - b) * (a - b) <= 1, for both channels, on the same module.
+        const __m512i d0 = _mm512_sub_epi32(channel0_i, channel0_j);
+        const __m512i d1 = _mm512_sub_epi32(channel1_i, channel1_j);
+        const __mmask16 same_module =
+            _mm512_cmpeq_epi32_mask(module_i, module_j);
+        const __mmask16 adjacent = _mm512_mask_cmple_epu32_mask(
+            _mm512_mask_cmple_epu32_mask(same_module,
+                                         _mm512_mullo_epi32(d0, d0), one),
+            _mm512_mullo_epi32(d1, d1), one);
+
+        // a.channel1() > b.channel1() + 1, or different modules.
+        const __mmask16 far_channel1 = _mm512_cmpgt_epu32_mask(
+            channel1_i, _mm512_add_epi32(channel1_j, one));
+
+        const auto adjacent_mask = static_cast<unsigned int>(adjacent);
+        const auto far_mask =
+            (static_cast<unsigned int>(far_channel1) |
+             (~static_cast<unsigned int>(same_module) & 0xffffu)) &
+            ~adjacent_mask;
+
+        n_far += static_cast<unsigned int>(std::popcount(far_mask));
+        merge_adjacent(labels, adjacent_mask, j, ai);
+    }
+
+    // Process the remaining candidates one-by-one.
+    return n_far + scan_scalar(cells, labels, i, j, ai);
+}
+
+#endif  // TRACCC_X86_SIMD_SPARSE_CCL
+
+/// Type of the functions scanning the candidate neighbours of a cell
+using scan_function = unsigned int (*)(
+    const edm::silicon_cell_collection::const_device&,
+    vecmem::device_vector<unsigned int>&, unsigned int, unsigned int,
+    unsigned int&);
+
+/// Select the best scan function for the current CPU
+scan_function select_best_scan() {
+
+#if defined(TRACCC_X86_SIMD_SPARSE_CCL)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return scan_avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return scan_avx2;
+    }
+#endif
+    return scan_scalar;
+}
+
+/// Get the scan function for a requested implementation
+scan_function select_scan(sparse_ccl_scan scan) {
+
+    switch (scan) {
+        case sparse_ccl_scan::automatic: {
+            // The best scan function is selected only once.
+            static const scan_function best = select_best_scan();
+            return best;
+        }
+        case sparse_ccl_scan::scalar:
+            return scan_scalar;
+#if defined(TRACCC_X86_SIMD_SPARSE_CCL)
+        case sparse_ccl_scan::avx2:
+            return scan_avx2;
+        case sparse_ccl_scan::avx512:
+            return scan_avx512;
+#endif
+        default:
+            throw std::invalid_argument(
+                "Requested SparseCCL scan is not available in this build");
+    }
+}
+
+}  // namespace
+
+unsigned int simd_sparse_ccl(
+    const edm::silicon_cell_collection::const_device& cells,
+    vecmem::device_vector<unsigned int>& labels, unsigned int begin,
+    unsigned int end, sparse_ccl_scan scan_kind) {
+
+    assert(begin <= end);
+    assert(end <= cells.size());
+
+    // The scan function to use.
+    const scan_function scan = select_scan(scan_kind);
+
+    unsigned int nlabels = 0;
+
+    // first scan: pixel association
+    unsigned int start_j = begin;
+    for (unsigned int i = begin; i < end; ++i) {
+
+        labels[i] = i;
+        unsigned int ai = i;
+        start_j += scan(cells, labels, i, start_j, ai);
+    }
+
+    // second scan: transitive closure
+    for (unsigned int i = begin; i < end; ++i) {
+        if (labels[i] == i) {
+            labels[i] = nlabels++;
+        } else {
+            labels[i] = labels[labels[i]];
+        }
+    }
+    return nlabels;
+}
+
+}  // namespace traccc::host::details
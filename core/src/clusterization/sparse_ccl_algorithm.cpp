@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,22 +8,34 @@
 // Library include(s).
 #include "traccc/clusterization/sparse_ccl_algorithm.hpp"
 
-#include "traccc/clusterization/details/sparse_ccl.hpp"
+#include "traccc/clusterization/details/simd_sparse_ccl.hpp"
 #include "traccc/sanity/contiguous_on.hpp"
 #include "traccc/sanity/ordered_on.hpp"
 #include "traccc/utils/projections.hpp"
 #include "traccc/utils/relations.hpp"
 
+// Local include(s).
+#include "module_chunks.hpp"
+
 // VecMem include(s).
 #include <vecmem/containers/device_vector.hpp>
 #include <vecmem/containers/vector.hpp>
 
+// System include(s).
+#include <cstddef>
+#include <vector>
+
 namespace traccc::host {
 
 sparse_ccl_algorithm::sparse_ccl_algorithm(vecmem::memory_resource& mr,
                                            std::unique_ptr<const Logger> logger)
     : messaging(std::move(logger)), m_mr(mr) {}
 
+void sparse_ccl_algorithm::set_intra_event_parallelism(bool value) {
+
+    m_intra_event_parallelism = value;
+}
+
 sparse_ccl_algorithm::output_type sparse_ccl_algorithm::operator()(
     const edm::silicon_cell_collection::const_view& cells_view,
     const detector_conditions_description::const_view& det_cond_view) const {
@@ -36,21 +48,59 @@ sparse_ccl_algorithm::output_type sparse_ccl_algorithm::operator()(
     assert(is_contiguous_on(cell_module_projection(), cells));
     assert(is_ordered_on(channel0_major_cell_order_relation(), cells));
 
-    // Run SparseCCL to fill CCL indices.
+    // Split the cells into chunks of whole modules, which can be labelled
+    // independently of each other. (If intra-event parallelism is enabled.
+    // Otherwise all cells end up in a single chunk.)
+    const std::vector<unsigned int> chunks =
+        details::module_aligned_chunks(cells, m_intra_event_parallelism);
+    const std::size_t n_chunks = chunks.size() - 1u;
+
+    // Run SparseCCL on each chunk to fill CCL indices, numbered from zero
+    // in each chunk.
     vecmem::vector<unsigned int> cluster_indices{cells.size(), &(m_mr.get())};
     vecmem::device_vector<unsigned int> cluster_indices_device{
         vecmem::get_data(cluster_indices)};
-    const unsigned int num_clusters =
-        details::sparse_ccl(cells, cluster_indices_device);
+    std::vector<unsigned int> chunk_clusters(n_chunks + 1u, 0u);
+    auto label_chunk = [&](std::size_t i) {
+        chunk_clusters[i + 1] = details::simd_sparse_ccl(
+            cells, cluster_indices_device, chunks[i], chunks[i + 1]);
+    };
+    details::for_each_chunk(n_chunks, label_chunk);
+
+    // Turn the per-chunk cluster counts into offsets, and shift the cluster
+    // indices of every chunk by them. Since the chunks are in cell order, the
+    // result is the same as what labelling all cells in one go would give.
+    for (std::size_t i = 0; i < n_chunks; ++i) {
+        chunk_clusters[i + 1] += chunk_clusters[i];
+    }
+    const unsigned int num_clusters = chunk_clusters.back();
+    for (std::size_t i = 1; i < n_chunks; ++i) {
+        for (unsigned int cell_idx = chunks[i]; cell_idx < chunks[i + 1];
+             ++cell_idx) {
+            cluster_indices[cell_idx] += chunk_clusters[i];
+        }
+    }
+
+    // Count the cells of every cluster.
+    vecmem::vector<unsigned int> cluster_sizes(num_clusters, 0u,
+                                               &(m_mr.get()));
+    for (unsigned int cluster_idx : cluster_indices) {
+        ++(cluster_sizes[cluster_idx]);
+    }
 
-    // Create the result container.
-    output_type clusters{m_mr.get()};
-    clusters.resize(num_clusters);
+    // Create the result container, with a single, flat allocation for the
+    // cell indices of all of the clusters.
+    output_type clusters{cluster_sizes, m_mr.get()};
+    edm::silicon_cluster_collection::device clusters_device{clusters};
 
-    // Add cells to their clusters.
+    // Scatter the cell indices into their clusters. Since the cells are
+    // visited in order, the cell indices of every cluster come out sorted.
+    vecmem::vector<unsigned int> cluster_fill(num_clusters, 0u, &(m_mr.get()));
     for (unsigned int cell_idx = 0; cell_idx < cluster_indices.size();
          ++cell_idx) {
-        clusters.cell_indices()[cluster_indices[cell_idx]].push_back(cell_idx);
+        const unsigned int cluster_idx = cluster_indices[cell_idx];
+        clusters_device.cell_indices()[cluster_idx]
+                                      [cluster_fill[cluster_idx]++] = cell_idx;
     }
 
     // Return the clusters.
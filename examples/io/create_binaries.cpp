@@ -6,10 +6,13 @@
  */
 
 // Project include(s).
+#include "traccc/io/event_container.hpp"
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_detector_description.hpp"
 #include "traccc/io/read_measurements.hpp"
+#include "traccc/io/read_particles.hpp"
 #include "traccc/io/read_spacepoints.hpp"
+#include "traccc/io/utils.hpp"
 #include "traccc/io/write.hpp"
 #include "traccc/options/detector.hpp"
 #include "traccc/options/input_data.hpp"
@@ -21,6 +24,8 @@
 
 // System include(s).
 #include <cstdlib>
+#include <filesystem>
+#include <optional>
 
 int create_binaries(const traccc::opts::detector& detector_opts,
                     const traccc::opts::input_data& input_opts,
@@ -38,6 +43,30 @@ int create_binaries(const traccc::opts::detector& detector_opts,
         detector_opts.digitization_file, detector_opts.conditions_file,
         traccc::data_format::json);
 
+    // Write the detector description in binary format as well.
+    traccc::io::write((std::filesystem::path(output_opts.directory) /
+                       "detector_description.dat")
+                          .native(),
+                      traccc::data_format::binary, vecmem::get_data(det_descr),
+                      vecmem::get_data(det_cond));
+
+    // The binary format to write. Using the memory mappable or the compressed
+    // format if it was explicitly requested.
+    const traccc::data_format output_format =
+        ((output_opts.format == traccc::data_format::mapped) ||
+                 (output_opts.format == traccc::data_format::compressed)
+             ? output_opts.format
+             : traccc::data_format::binary);
+
+    // Write all events into a single file, if the event container format was
+    // requested.
+    std::optional<traccc::io::event_container_writer> container;
+    if (output_opts.format == traccc::data_format::container) {
+        container.emplace(traccc::io::get_event_container_filename(
+                              output_opts.directory),
+                          input_opts.skip, input_opts.events);
+    }
+
     // Loop over events
     for (std::size_t event = input_opts.skip;
          event < input_opts.events + input_opts.skip; ++event) {
@@ -48,10 +77,14 @@ int create_binaries(const traccc::opts::detector& detector_opts,
                                logger->clone(), &det_cond, input_opts.format);
 
         // Write binary file
-        traccc::io::write(event, output_opts.directory,
-                          traccc::data_format::binary, vecmem::get_data(cells),
-                          vecmem::get_data(det_descr),
-                          vecmem::get_data(det_cond));
+        if (container) {
+            container->write(event, vecmem::get_data(cells));
+        } else {
+            traccc::io::write(event, output_opts.directory, output_format,
+                              vecmem::get_data(cells),
+                              vecmem::get_data(det_descr),
+                              vecmem::get_data(det_cond));
+        }
 
         // Read the measurements and hits from the relevant event file
         traccc::edm::measurement_collection::host measurements{host_mr};
@@ -61,9 +94,33 @@ int create_binaries(const traccc::opts::detector& detector_opts,
                                      nullptr, input_opts.format);
 
         // Write binary file(s)
-        traccc::io::write(
-            event, output_opts.directory, traccc::data_format::binary,
-            vecmem::get_data(spacepoints), vecmem::get_data(measurements));
+        if (container) {
+            container->write(event, vecmem::get_data(spacepoints));
+            container->write(event, vecmem::get_data(measurements));
+        } else {
+            traccc::io::write(event, output_opts.directory, output_format,
+                              vecmem::get_data(spacepoints),
+                              vecmem::get_data(measurements));
+        }
+
+        // Add the truth particles to the event container, if they are
+        // available.
+        if (container && (input_opts.format == traccc::data_format::csv) &&
+            std::filesystem::exists(traccc::io::get_absolute_path(
+                (std::filesystem::path(input_opts.directory) /
+                 traccc::io::get_event_filename(event,
+                                                "-particles_initial.csv"))
+                    .native()))) {
+            traccc::particle_collection_types::host particles{&host_mr};
+            traccc::io::read_particles(particles, event, input_opts.directory,
+                                       input_opts.format);
+            container->write(event, particles);
+        }
+    }
+
+    // Write the index of the event container file.
+    if (container) {
+        container->close();
     }
 
     return EXIT_SUCCESS;
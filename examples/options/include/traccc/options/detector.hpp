@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023-2025 CERN for the benefit of the ACTS project
+ * (c) 2023-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -39,6 +39,9 @@ class detector : public interface {
     /// since ODD has no changing detector conditions
     std::string conditions_file =
         "geometries/odd/odd-digi-geometric-config.json";
+    /// Binary detector description file, used instead of the detector,
+    /// digitization and conditions files for the detector description if set
+    std::string description_file = "";
 
     /// @}
 
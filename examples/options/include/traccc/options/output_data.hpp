@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2024 CERN for the benefit of the ACTS project
+ * (c) 2024-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,7 @@
 #include "traccc/options/details/interface.hpp"
 
 // System include(s).
+#include <cstddef>
 #include <string>
 #include <string_view>
 
@@ -28,6 +29,10 @@ class output_data : public interface {
     traccc::data_format format = data_format::csv;
     /// Directory of the input files
     std::string directory = "testing/";
+    /// Number of background threads writing the output files
+    std::size_t writer_threads = 1;
+    /// Maximum number of events waiting to be written
+    std::size_t writer_queue_size = 4;
 
     /// @}
 
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,7 @@
 
 // System include(s).
 #include <cstddef>
+#include <vector>
 
 namespace traccc::opts {
 
@@ -24,6 +25,17 @@ class threading : public interface {
 
     /// The number of threads to use for the data processing
     std::size_t threads = 1;
+    /// Split the clusterization and track fitting of individual events
+    /// between multiple threads
+    bool intra_event_parallelism = false;
+    /// Split the threads between the NUMA nodes of the host
+    bool numa_aware = false;
+    /// The number of worker processes to fork for the data processing
+    std::size_t processes = 1;
+    /// Pin each worker process to one NUMA node (socket) of the host
+    bool pin_processes = false;
+    /// Thread counts to run a scaling sweep with (empty for no sweep)
+    std::vector<std::size_t> thread_sweep;
 
     /// @}
 
@@ -25,8 +25,15 @@ class throughput : public interface {
 
     /// "Reconstruction stage" to run
     enum class stage {
-        seeding,  ///< Run until the end of seeding
-        full      ///< Run the full chain of reconstruction
+        clusterization,        ///< Run until the end of clusterization
+        spacepoint_formation,  ///< Run until the end of spacepoint formation
+        seeding,               ///< Run until the end of seeding
+        track_finding,         ///< Run only the track finding (from seeds)
+        track_fitting,         ///< Run only the track fitting (from
+                               ///< track candidates)
+        ambiguity_resolution,  ///< Run only the ambiguity resolution (from
+                               ///< track candidates)
+        full                   ///< Run the full chain of reconstruction
     };
     /// The reconstruction stage to run
     stage reco_stage = stage::full;
@@ -42,6 +49,24 @@ class throughput : public interface {
     /// Set the random event processing seed
     unsigned int random_seed = 0;
 
+    /// Process the events in the order of their predicted cost (cell count),
+    /// starting with the most expensive ones
+    bool lpt_scheduling = false;
+
+    /// Read the input events on the fly, instead of preloading them
+    bool stream_input = false;
+    /// The maximum number of events in flight while streaming the input
+    /// (0 means twice the number of processing threads)
+    std::size_t events_in_flight = 0;
+
+    /// Allocate the per-event memory of the algorithms from an arena, which
+    /// is reset after every event
+    bool event_memory_arena = false;
+    /// Collect statistics about the memory allocations of the algorithms
+    bool memory_statistics = false;
+    /// Collect hardware performance counter values for the processing stages
+    bool hardware_counters = false;
+
     /// Output log file
     std::string log_file;
 
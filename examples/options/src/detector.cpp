@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2023-2025 CERN for the benefit of the ACTS project
+ * (c) 2023-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -38,6 +38,11 @@ detector::detector() : interface("Detector Options") {
         "conditions-file",
         po::value(&conditions_file)->default_value(conditions_file),
         "Conditions file");
+    m_desc.add_options()(
+        "description-file",
+        po::value(&description_file)->default_value(description_file),
+        "Binary detector description file (replacing the detector, "
+        "digitization and conditions files for the detector description)");
 }
 
 std::unique_ptr<configuration_printable> detector::as_printable() const {
@@ -53,6 +58,8 @@ std::unique_ptr<configuration_printable> detector::as_printable() const {
                                                            digitization_file));
     cat->add_child(std::make_unique<configuration_kv_pair>("Conditions file",
                                                            conditions_file));
+    cat->add_child(std::make_unique<configuration_kv_pair>("Description file",
+                                                           description_file));
 
     return cat;
 }
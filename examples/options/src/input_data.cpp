@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2024-2025 CERN for the benefit of the ACTS project
+ * (c) 2024-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -54,6 +54,12 @@ void input_data::read(const po::variables_map &vm) {
             format = data_format::csv;
         } else if (input_format_string == "binary") {
             format = data_format::binary;
+        } else if (input_format_string == "mapped") {
+            format = data_format::mapped;
+        } else if (input_format_string == "container") {
+            format = data_format::container;
+        } else if (input_format_string == "compressed") {
+            format = data_format::compressed;
         } else if (input_format_string == "json") {
             format = data_format::json;
         } else {
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2024-2025 CERN for the benefit of the ACTS project
+ * (c) 2024-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,6 +13,7 @@
 // System include(s).
 #include <sstream>
 #include <stdexcept>
+#include <string>
 
 namespace traccc::opts {
 
@@ -33,10 +34,24 @@ output_data::output_data(traccc::data_format f, std::string_view d)
     m_desc.add_options()("output-directory",
                          po::value(&directory)->default_value(directory),
                          "Directory to store the output files");
+    m_desc.add_options()(
+        "output-writer-threads",
+        po::value(&writer_threads)->default_value(writer_threads),
+        "Number of background threads writing the output files (0: write "
+        "them synchronously)");
+    m_desc.add_options()(
+        "output-queue-size",
+        po::value(&writer_queue_size)->default_value(writer_queue_size),
+        "Maximum number of events waiting to be written");
 }
 
 void output_data::read(const boost::program_options::variables_map& vm) {
 
+    // Check the writer settings.
+    if (writer_queue_size == 0) {
+        throw std::invalid_argument("The output queue size must be positive");
+    }
+
     // Decode the input data format.
     if (vm.count(data_format_option)) {
         const std::string input_format_string =
@@ -45,6 +60,12 @@ void output_data::read(const boost::program_options::variables_map& vm) {
             format = data_format::csv;
         } else if (input_format_string == "binary") {
             format = data_format::binary;
+        } else if (input_format_string == "mapped") {
+            format = data_format::mapped;
+        } else if (input_format_string == "container") {
+            format = data_format::container;
+        } else if (input_format_string == "compressed") {
+            format = data_format::compressed;
         } else if (input_format_string == "json") {
             format = data_format::json;
         } else if (input_format_string == "obj") {
@@ -64,6 +85,10 @@ std::unique_ptr<configuration_printable> output_data::as_printable() const {
                                                            format_ss.str()));
     cat->add_child(
         std::make_unique<configuration_kv_pair>("Output directory", directory));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Output writer threads", std::to_string(writer_threads)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Output queue size", std::to_string(writer_queue_size)));
 
     return cat;
 }
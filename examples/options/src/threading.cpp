@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2025 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -11,23 +11,74 @@
 #include "traccc/examples/utils/printable.hpp"
 
 // System include(s).
+#include <algorithm>
+#include <charconv>
+#include <format>
 #include <stdexcept>
+#include <string>
 
 namespace traccc::opts {
 
+/// Name of the thread sweep option
+static const char* thread_sweep_option = "thread-sweep";
+
 threading::threading() : interface("Multi-Threading Options") {
 
     m_desc.add_options()(
         "cpu-threads",
         boost::program_options::value(&threads)->default_value(threads),
         "The number of CPU threads to use");
+    m_desc.add_options()(
+        "intra-event-parallelism",
+        boost::program_options::bool_switch(&intra_event_parallelism),
+        "Parallelise the clusterization and the track fitting of individual "
+        "events (in algorithms that support it)");
+    m_desc.add_options()(
+        "numa-aware", boost::program_options::bool_switch(&numa_aware),
+        "Bind the processing threads to the NUMA nodes of the host");
+    m_desc.add_options()(
+        "processes",
+        boost::program_options::value(&processes)->default_value(processes),
+        "The number of worker processes to fork, each using the requested "
+        "number of CPU threads");
+    m_desc.add_options()(
+        "pin-processes", boost::program_options::bool_switch(&pin_processes),
+        "Pin each worker process to one NUMA node (socket) of the host");
+    m_desc.add_options()(
+        thread_sweep_option, boost::program_options::value<std::string>(),
+        "Comma separated list of thread counts to measure the throughput "
+        "with, re-using the same detector and input (e.g. \"1,2,4,8\")");
 }
 
-void threading::read(const boost::program_options::variables_map &) {
+void threading::read(const boost::program_options::variables_map &vm) {
 
     if (threads == 0) {
         throw std::invalid_argument{"Must use threads>0"};
     }
+    if (processes == 0) {
+        throw std::invalid_argument{"Must use processes>0"};
+    }
+    if (vm.count(thread_sweep_option)) {
+        const std::string sweep = vm[thread_sweep_option].as<std::string>();
+        thread_sweep.clear();
+        for (std::size_t begin = 0; begin <= sweep.size();) {
+            const std::size_t end =
+                std::min(sweep.find(',', begin), sweep.size());
+            std::size_t value = 0;
+            const auto [ptr, ec] = std::from_chars(
+                sweep.data() + begin, sweep.data() + end, value);
+            if ((ec != std::errc{}) || (ptr != sweep.data() + end) ||
+                (value == 0)) {
+                throw std::invalid_argument{"Invalid thread sweep: " + sweep};
+            }
+            thread_sweep.push_back(value);
+            begin = end + 1;
+        }
+        if (processes > 1) {
+            throw std::invalid_argument{
+                "Thread sweeps can not be used with multiple processes"};
+        }
+    }
 }
 
 std::unique_ptr<configuration_printable> threading::as_printable() const {
@@ -35,6 +86,24 @@ std::unique_ptr<configuration_printable> threading::as_printable() const {
 
     cat->add_child(std::make_unique<configuration_kv_pair>(
         "Number of CPU thread", std::to_string(threads)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Intra-event parallelism", std::format("{}", intra_event_parallelism)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "NUMA aware", std::format("{}", numa_aware)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Number of processes", std::to_string(processes)));
+    if (processes > 1) {
+        cat->add_child(std::make_unique<configuration_kv_pair>(
+            "Pin processes", std::format("{}", pin_processes)));
+    }
+    if (!thread_sweep.empty()) {
+        std::string sweep;
+        for (std::size_t value : thread_sweep) {
+            sweep += (sweep.empty() ? "" : ",") + std::to_string(value);
+        }
+        cat->add_child(
+            std::make_unique<configuration_kv_pair>("Thread sweep", sweep));
+    }
 
     return cat;
 }
@@ -27,7 +27,10 @@ throughput::throughput() : interface("Throughput Measurement Options") {
 
     m_desc.add_options()(
         stage_option, po::value<stage_type>()->default_value("full"),
-        "Reconstruction stage to run (\"seeding\" or \"full\")");
+        "Reconstruction stage to run (\"clusterization\", \"spacepoints\", "
+        "\"seeding\", \"finding\", \"fitting\", \"ambiguity\" or \"full\"). "
+        "\"finding\", \"fitting\" and \"ambiguity\" only run the one stage, "
+        "on inputs prepared before the warm-up");
     m_desc.add_options()(
         "processed-events",
         po::value(&processed_events)->default_value(processed_events),
@@ -43,6 +46,31 @@ throughput::throughput() : interface("Throughput Measurement Options") {
     m_desc.add_options()("random-seed",
                          po::value(&random_seed)->default_value(random_seed),
                          "Seed for event randomization (0 to use time)");
+    m_desc.add_options()(
+        "lpt-scheduling", po::bool_switch(&lpt_scheduling),
+        "Process the events with the most cells first (longest processing "
+        "time first scheduling)");
+    m_desc.add_options()(
+        "stream-input", po::bool_switch(&stream_input),
+        "Read the input events during the processing, instead of preloading "
+        "them");
+    m_desc.add_options()(
+        "events-in-flight",
+        po::value(&events_in_flight)->default_value(events_in_flight),
+        "Maximum number of events in flight while streaming the input (0 to "
+        "use twice the number of threads)");
+    m_desc.add_options()(
+        "event-memory-arena", po::bool_switch(&event_memory_arena),
+        "Allocate the per-event memory of the algorithms from an arena that "
+        "is reset after every event");
+    m_desc.add_options()(
+        "memory-statistics", po::bool_switch(&memory_statistics),
+        "Collect and print statistics about the memory allocations of the "
+        "algorithms");
+    m_desc.add_options()(
+        "hardware-counters", po::bool_switch(&hardware_counters),
+        "Collect hardware performance counter values (cycles, instructions, "
+        "cache and branch misses) for the processing stages");
     m_desc.add_options()(
         "log-file", po::value(&log_file),
         "File where result logs will be printed (in append mode).");
@@ -55,12 +83,37 @@ void throughput::read(const po::variables_map& vm) {
         const std::string stage_string = vm[stage_option].as<stage_type>();
         if (stage_string == "full") {
             reco_stage = stage::full;
+        } else if (stage_string == "clusterization") {
+            reco_stage = stage::clusterization;
+        } else if (stage_string == "spacepoints") {
+            reco_stage = stage::spacepoint_formation;
         } else if (stage_string == "seeding") {
             reco_stage = stage::seeding;
+        } else if (stage_string == "finding") {
+            reco_stage = stage::track_finding;
+        } else if (stage_string == "fitting") {
+            reco_stage = stage::track_fitting;
+        } else if (stage_string == "ambiguity") {
+            reco_stage = stage::ambiguity_resolution;
         } else {
             throw std::invalid_argument("Unknown reconstruction stage");
         }
     }
+
+    // The stages running on prepared inputs need preloaded events.
+    if (stream_input && (reco_stage == stage::track_finding ||
+                         reco_stage == stage::track_fitting ||
+                         reco_stage == stage::ambiguity_resolution)) {
+        throw std::invalid_argument(
+            "Stages running on prepared inputs can not be used with streamed "
+            "input");
+    }
+
+    // The cost of the events can only be predicted for preloaded events.
+    if (lpt_scheduling && stream_input) {
+        throw std::invalid_argument(
+            "LPT scheduling can not be used with streamed input");
+    }
 }
 
 std::unique_ptr<configuration_printable> throughput::as_printable() const {
@@ -68,9 +121,24 @@ std::unique_ptr<configuration_printable> throughput::as_printable() const {
 
     std::string reco_stage_string;
     switch (reco_stage) {
+        case stage::clusterization:
+            reco_stage_string = "clusterization";
+            break;
+        case stage::spacepoint_formation:
+            reco_stage_string = "spacepoints";
+            break;
         case stage::seeding:
             reco_stage_string = "seeding";
             break;
+        case stage::track_finding:
+            reco_stage_string = "finding";
+            break;
+        case stage::track_fitting:
+            reco_stage_string = "fitting";
+            break;
+        case stage::ambiguity_resolution:
+            reco_stage_string = "ambiguity";
+            break;
         case stage::full:
             reco_stage_string = "full";
             break;
@@ -84,6 +152,22 @@ std::unique_ptr<configuration_printable> throughput::as_printable() const {
         "Cold run events", std::to_string(cold_run_events)));
     cat->add_child(std::make_unique<configuration_kv_pair>(
         "Processed events", std::to_string(processed_events)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "LPT scheduling", std::format("{}", lpt_scheduling)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Stream input", std::format("{}", stream_input)));
+    if (stream_input) {
+        cat->add_child(std::make_unique<configuration_kv_pair>(
+            "Events in flight", events_in_flight == 0
+                                    ? "automatic"
+                                    : std::to_string(events_in_flight)));
+    }
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Event memory arena", std::format("{}", event_memory_arena)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Memory statistics", std::format("{}", memory_statistics)));
+    cat->add_child(std::make_unique<configuration_kv_pair>(
+        "Hardware counters", std::format("{}", hardware_counters)));
     cat->add_child(
         std::make_unique<configuration_kv_pair>("Log file", log_file));
     cat->add_child(std::make_unique<configuration_kv_pair>(
@@ -0,0 +1,185 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace traccc::details {
+
+/// Memory resource counting the (de-)allocations made through it
+///
+/// It also measures the time spent in the upstream resource. It can be used
+/// from multiple threads at the same time.
+///
+class counting_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// Constructor with the upstream memory resource
+    explicit counting_memory_resource(vecmem::memory_resource& upstream);
+
+    /// Get the number of allocations made through the resource
+    std::size_t allocations() const;
+    /// Get the time spent in the (de-)allocations of the upstream resource
+    std::chrono::nanoseconds time() const;
+
+    private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    void* do_allocate(std::size_t size, std::size_t alignment) override;
+    void do_deallocate(void* ptr, std::size_t size,
+                       std::size_t alignment) override;
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override;
+
+    /// @}
+
+    /// The upstream memory resource
+    vecmem::memory_resource& m_upstream;
+    /// The number of allocations made
+    std::atomic_size_t m_allocations{0u};
+    /// The time spent in the upstream resource (in nanoseconds)
+    std::atomic<std::chrono::nanoseconds::rep> m_time{0};
+
+};  // class counting_memory_resource
+
+/// Monotonic memory resource for allocations that only live for one event
+///
+/// Memory is handed out from large blocks, requested from the upstream
+/// resource, and deallocation is a no-op. After each event the resource is
+/// "reset", which makes the memory of all blocks available again. Blocks are
+/// never given back to the upstream resource before the resource's
+/// destruction, so after the first few events, no upstream allocations are
+/// made anymore.
+///
+/// The resource must only be used from a single thread at a time.
+///
+class event_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// Constructor with the upstream memory resource
+    ///
+    /// @param upstream   The resource to allocate the memory blocks with
+    /// @param block_size The size of the first memory block
+    ///
+    explicit event_memory_resource(vecmem::memory_resource& upstream,
+                                   std::size_t block_size = 1024u * 1024u);
+    /// Destructor, giving all memory blocks back to the upstream resource
+    ~event_memory_resource() override;
+
+    /// Keep all memory allocated so far, even across resets
+    ///
+    /// It allows allocations made before the first event, for instance
+    /// while constructing an algorithm, to survive the resets.
+    ///
+    void checkpoint();
+    /// Release all memory allocated since the last checkpoint
+    ///
+    /// All memory allocated through the resource since the last checkpoint
+    /// must have been deallocated by the time this function is called.
+    ///
+    void reset();
+
+    /// Get the number of allocations made through the resource
+    std::size_t allocations() const;
+
+    private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    void* do_allocate(std::size_t size, std::size_t alignment) override;
+    void do_deallocate(void* ptr, std::size_t size,
+                       std::size_t alignment) override;
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override;
+
+    /// @}
+
+    /// One block of memory
+    struct block {
+        /// Pointer to the beginning of the block
+        std::byte* m_ptr = nullptr;
+        /// Size of the block
+        std::size_t m_size = 0u;
+    };
+
+    /// Position inside the memory blocks
+    struct position {
+        /// Index of the block
+        std::size_t m_block = 0u;
+        /// Offset inside the block
+        std::size_t m_offset = 0u;
+    };
+
+    /// The upstream memory resource
+    vecmem::memory_resource& m_upstream;
+    /// The memory blocks allocated so far
+    std::vector<block> m_blocks;
+    /// The size of the next block to allocate
+    std::size_t m_next_block_size;
+    /// The current position of the allocations
+    position m_current;
+    /// The position to reset to
+    position m_checkpoint;
+    /// The number of allocations made
+    std::size_t m_allocations = 0u;
+
+};  // class event_memory_resource
+
+/// Memory resource(s) used by one full chain algorithm instance
+///
+/// Depending on the configuration, the algorithm allocates memory directly
+/// from the upstream resource, or from an @c event_memory_resource, with or
+/// without counting the allocations.
+///
+class event_memory {
+
+    public:
+    /// Constructor with the upstream memory resource and the configuration
+    ///
+    /// @param upstream   The resource to ultimately allocate memory from
+    /// @param use_arena  Whether to use an @c event_memory_resource
+    /// @param count      Whether to count the allocations
+    ///
+    event_memory(vecmem::memory_resource& upstream, bool use_arena,
+                 bool count);
+
+    /// The memory resource that the algorithm should use
+    vecmem::memory_resource& resource();
+
+    /// Function to call once the algorithm has been constructed
+    void checkpoint();
+    /// Function to call after the processing of every event
+    void end_event();
+
+    /// Get the number of allocations made by the algorithm
+    std::size_t requested_allocations() const;
+    /// Get the number of allocations made from the upstream resource
+    std::size_t upstream_allocations() const;
+    /// Get the time spent in the (de-)allocations of the upstream resource
+    std::chrono::nanoseconds upstream_time() const;
+
+    private:
+    /// The upstream memory resource
+    vecmem::memory_resource& m_upstream;
+    /// Optional resource counting the upstream allocations
+    std::unique_ptr<counting_memory_resource> m_counting;
+    /// Optional per-event arena
+    std::unique_ptr<event_memory_resource> m_arena;
+
+};  // class event_memory
+
+}  // namespace traccc::details
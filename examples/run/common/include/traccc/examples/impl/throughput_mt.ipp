@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2025 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,7 +8,12 @@
 #pragma once
 
 // Local include(s).
+#include "traccc/examples/event_memory.hpp"
 #include "traccc/examples/make_magnetic_field.hpp"
+#include "traccc/examples/process_pool.hpp"
+#include "traccc/examples/report_latencies.hpp"
+#include "traccc/examples/report_scaling.hpp"
+#include "traccc/examples/run_stage.hpp"
 
 // Project include(s)
 #include "traccc/geometry/detector.hpp"
@@ -34,9 +39,12 @@
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_detector.hpp"
 #include "traccc/io/read_detector_description.hpp"
+#include "traccc/io/serial_reading.hpp"
 #include "traccc/io/utils.hpp"
 
 // Performance measurement include(s).
+#include "traccc/performance/hardware_counters.hpp"
+#include "traccc/performance/latency_info.hpp"
 #include "traccc/performance/throughput.hpp"
 #include "traccc/performance/timer.hpp"
 #include "traccc/performance/timing_info.hpp"
@@ -47,7 +55,9 @@
 
 // TBB include(s).
 #include <tbb/global_control.h>
+#include <tbb/info.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_pipeline.h>
 #include <tbb/task_arena.h>
 #include <tbb/task_group.h>
 
@@ -55,13 +65,18 @@
 #include "traccc/examples/indicators.hpp"
 
 // System include(s).
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <ctime>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
+#include <tuple>
 #include <vector>
 
 namespace traccc {
@@ -97,53 +112,160 @@ int throughput_mt(std::string_view description, int argc, char* argv[]) {
     TRACCC_LOCAL_LOGGER(
         prelogger->clone(std::nullopt, traccc::Logging::Level(logging_opts)));
 
+    // Validate the option combinations before reading any input, and before
+    // forking any worker process, so that errors are reported only once.
+
+    // Make sure that the algorithm supports the requested stage.
+    details::check_stage_support<FULL_CHAIN_ALG>(throughput_opts.reco_stage);
+
+    // Check whether the algorithm could split up the work of single events,
+    // if this was requested. The tasks that it launches for this end up in
+    // the same TBB arena that the events themselves are processed in.
+    static constexpr bool HAS_INTRA_EVENT_PARALLELISM =
+        requires(FULL_CHAIN_ALG& alg) {
+            alg.set_intra_event_parallelism(true);
+        };
+    if (threading_opts.intra_event_parallelism &&
+        !HAS_INTRA_EVENT_PARALLELISM) {
+        throw std::invalid_argument(
+            "Intra-event parallelism is not supported by this algorithm");
+    }
+
+    // The per-event memory arenas are not thread safe, so they can not be
+    // used together with intra-event parallelism.
+    if (throughput_opts.event_memory_arena &&
+        threading_opts.intra_event_parallelism) {
+        throw std::invalid_argument(
+            "Event memory arenas can not be used with intra-event "
+            "parallelism");
+    }
+
     // Set up the timing info holder.
     performance::timing_info times;
 
     // Memory resource to use in the test.
     vecmem::host_memory_resource host_mr;
 
+    // When using multiple worker processes, all read-only objects (the
+    // detector, its description and the input events) are set up in shared
+    // memory. So that the workers would not need their own copies.
+    const bool multi_process = (threading_opts.processes > 1);
+    std::unique_ptr<details::shared_memory_resource> shared_mr;
+    if (multi_process) {
+        shared_mr = std::make_unique<details::shared_memory_resource>();
+    }
+    vecmem::memory_resource& const_mr =
+        (multi_process ? static_cast<vecmem::memory_resource&>(*shared_mr)
+                       : host_mr);
+
+    // Start reading the magnetic field in the background. It is typically the
+    // largest input file, so reading it should not hold up the reading of the
+    // detector and of the events.
+    std::future<magnetic_field> field_future =
+        std::async(std::launch::async,
+                   [&]() { return details::make_magnetic_field(bfield_opts); });
+
     // Construct the detector description object.
-    traccc::detector_design_description::host det_descr{host_mr};
-    traccc::detector_conditions_description::host det_cond{host_mr};
-    traccc::io::read_detector_description(
-        det_descr, det_cond, detector_opts.detector_file,
-        detector_opts.digitization_file, detector_opts.conditions_file,
-        traccc::data_format::json);
+    traccc::detector_design_description::host det_descr{const_mr};
+    traccc::detector_conditions_description::host det_cond{const_mr};
+    if (detector_opts.description_file.empty()) {
+        traccc::io::read_detector_description(
+            det_descr, det_cond, detector_opts.detector_file,
+            detector_opts.digitization_file, detector_opts.conditions_file,
+            traccc::data_format::json);
+    } else {
+        traccc::io::read_detector_description(
+            det_descr, det_cond, detector_opts.description_file, "", "",
+            traccc::data_format::binary);
+    }
 
     // Construct a Detray detector object, if supported by the configuration.
     traccc::host_detector detector;
-    traccc::io::read_detector(detector, host_mr, detector_opts.detector_file,
+    traccc::io::read_detector(detector, const_mr, detector_opts.detector_file,
                               detector_opts.material_file,
                               detector_opts.grid_file);
 
-    // Construct the magnetic field object.
-    const auto field = details::make_magnetic_field(bfield_opts);
-
-    // Read in all input events into memory.
-    vecmem::vector<edm::silicon_cell_collection::host> input{&host_mr};
-    {
+    // Helper function reading in the cells of a single event.
+    auto read_event = [&](edm::silicon_cell_collection::host& cells,
+                          std::size_t event) {
+        static constexpr bool DEDUPLICATE = true;
+        io::read_cells(cells, event, input_opts.directory, logger().clone(),
+                       &det_cond, input_opts.format, DEDUPLICATE,
+                       input_opts.use_acts_geom_source);
+    };
+
+    // Read in all input events into memory, unless they are to be streamed.
+    vecmem::vector<edm::silicon_cell_collection::host> input{&const_mr};
+    if (!throughput_opts.stream_input) {
         performance::timer t{"File reading", times};
         // Set up the container for the input events.
         input.reserve(input_opts.events);
         const std::size_t first_event = input_opts.skip;
         const std::size_t last_event = input_opts.skip + input_opts.events;
         for (std::size_t i = first_event; i < last_event; ++i) {
-            input.emplace_back(host_mr);
+            input.emplace_back(const_mr);
         }
-        // Read the input cells into memory in parallel.
-        tbb::parallel_for(
-            tbb::blocked_range<std::size_t>{first_event, last_event},
+        auto read_events =
             [&](const tbb::blocked_range<std::size_t>& event_range) {
                 for (std::size_t event = event_range.begin();
                      event != event_range.end(); ++event) {
-                    static constexpr bool DEDUPLICATE = true;
-                    io::read_cells(input.at(event - input_opts.skip), event,
-                                   input_opts.directory, logger().clone(),
-                                   &det_cond, input_opts.format, DEDUPLICATE,
-                                   input_opts.use_acts_geom_source);
+                    read_event(input.at(event - input_opts.skip), event);
                 }
-            });
+            };
+        // Read the input cells into memory in parallel. Unless worker
+        // processes are to be forked, since TBB must not be initialised
+        // before forking. In which case the readers must not parse the
+        // files in parallel either.
+        if (multi_process) {
+            const io::serial_reading serial;
+            read_events({first_event, last_event});
+        } else {
+            tbb::parallel_for(
+                tbb::blocked_range<std::size_t>{first_event, last_event},
+                read_events);
+        }
+    }
+
+    // Wait for the magnetic field to be read. (With multiple worker processes
+    // it is shared with the workers through copy-on-write pages. The reading
+    // thread is joined here, before any process would be forked.)
+    const magnetic_field field = field_future.get();
+
+    // Set up the collection of hardware counter values, if requested. (The
+    // worker processes would not send these back to their parent.)
+    if (throughput_opts.hardware_counters) {
+        if (multi_process) {
+            throw std::invalid_argument(
+                "Hardware counters can not be used with multiple processes");
+        }
+        if (!performance::hardware_counters::enable()) {
+            TRACCC_WARNING(
+                "Hardware performance counters are not available on this "
+                "host");
+        } else if (threading_opts.intra_event_parallelism) {
+            TRACCC_WARNING(
+                "Hardware counters only see the work of the thread "
+                "processing the event, not of the tasks that it launches");
+        }
+    }
+
+    // Fork the worker processes, if requested. The parent process only waits
+    // for the workers to finish, and reports their aggregated results.
+    std::unique_ptr<details::process_pool> workers;
+    if (multi_process) {
+        TRACCC_INFO("Forking " << threading_opts.processes
+                               << " worker processes, sharing "
+                               << shared_mr->used() / (1024 * 1024)
+                               << " MB of read-only data");
+        shared_mr->freeze();
+        workers = std::make_unique<details::process_pool>(
+            threading_opts.processes, threading_opts.pin_processes);
+        if (workers->is_parent()) {
+            details::report_workers(workers->collect(), threading_opts.threads,
+                                    input_opts.directory, input_opts.events,
+                                    throughput_opts.log_file, logger());
+            return 0;
+        }
     }
 
     // Algorithm configuration(s).
@@ -167,45 +289,132 @@ int throughput_mt(std::string_view description, int argc, char* argv[]) {
         fitting_opts);
     fitting_cfg.propagation = propagation_config;
 
-    // Set up the full-chain algorithm(s). One for each thread.
-    std::vector<FULL_CHAIN_ALG> algs;
-    algs.reserve(threading_opts.threads + 1);
-    for (std::size_t i = 0; i < threading_opts.threads + 1; ++i) {
-        algs.push_back({host_mr, clustering_cfg, seedfinder_config,
-                        spacepoint_grid_config, seedfilter_config, gbts_config,
-                        track_params_estimation_config, finding_cfg,
-                        fitting_cfg, det_descr, det_cond, field, &detector,
-                        logger().clone(), seeding_gbts_opts.useGBTS});
-    }
-
-    // Set up a lambda that calls the correct function on the algorithms.
-    std::function<std::size_t(int, const edm::silicon_cell_collection::host&)>
-        process_event;
-    if (throughput_opts.reco_stage == opts::throughput::stage::seeding) {
-        process_event = [&](int thread,
-                            const edm::silicon_cell_collection::host& cells)
-            -> std::size_t {
-            return algs.at(static_cast<std::size_t>(thread))
-                .seeding(cells)
-                .size();
-        };
-    } else if (throughput_opts.reco_stage == opts::throughput::stage::full) {
-        process_event = [&](int thread,
-                            const edm::silicon_cell_collection::host& cells)
-            -> std::size_t {
-            return algs.at(static_cast<std::size_t>(thread))(cells).size();
-        };
-    } else {
-        throw std::invalid_argument("Unknown reconstruction stage");
-    }
-
-    // Set up the TBB arena and thread group. From here on out TBB is only
-    // allowed to use the specified number of threads.
+    // The thread count(s) to measure the throughput with. In a thread sweep
+    // only the TBB arena(s) are re-created for every thread count, the
+    // detector, the input and the algorithms are re-used.
+    const std::vector<std::size_t> thread_counts =
+        (threading_opts.thread_sweep.empty()
+             ? std::vector<std::size_t>{threading_opts.threads}
+             : threading_opts.thread_sweep);
+    const std::size_t max_threads =
+        *std::max_element(thread_counts.begin(), thread_counts.end());
+
+    // Set up the TBB arena(s). From here on out TBB is only allowed to use
+    // the (largest) specified number of threads. If requested, the threads
+    // are split between one arena per NUMA node of the host.
     tbb::global_control global_thread_limit(
-        tbb::global_control::max_allowed_parallelism,
-        threading_opts.threads + 1);
-    tbb::task_arena arena{static_cast<int>(threading_opts.threads), 0};
-    tbb::task_group group;
+        tbb::global_control::max_allowed_parallelism, max_threads + 1);
+    const std::vector<tbb::numa_node_id> numa_nodes =
+        (threading_opts.numa_aware
+             ? tbb::info::numa_nodes()
+             : std::vector<tbb::numa_node_id>{tbb::task_arena::automatic});
+    std::size_t n_threads = 0;
+    std::size_t n_arenas = 0;
+    std::vector<std::unique_ptr<tbb::task_arena>> arenas;
+    std::vector<tbb::task_group> groups;
+    // Every thread of every arena gets its own "slot" in the algorithm pool.
+    // With one extra slot per arena, for the thread launching the work. The
+    // pool is large enough for the largest thread count.
+    std::vector<std::size_t> slot_offsets;
+    const std::size_t n_slots =
+        max_threads + std::min(numa_nodes.size(), max_threads);
+    // The maximum number of events in flight while streaming the input.
+    std::size_t events_in_flight = 0;
+
+    // Helper function (re-)creating the arena(s) for a given thread count.
+    auto setup_arenas = [&](std::size_t threads) {
+        n_threads = threads;
+        n_arenas = std::min(numa_nodes.size(), threads);
+        arenas.clear();
+        groups = std::vector<tbb::task_group>(n_arenas);
+        slot_offsets.clear();
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < n_arenas; ++i) {
+            const std::size_t arena_threads =
+                threads / n_arenas + (i < threads % n_arenas ? 1 : 0);
+            arenas.push_back(std::make_unique<tbb::task_arena>(
+                tbb::task_arena::constraints{}
+                    .set_numa_id(numa_nodes[i])
+                    .set_max_concurrency(static_cast<int>(arena_threads)),
+                0));
+            slot_offsets.push_back(offset);
+            offset += arena_threads + 1;
+        }
+        events_in_flight = (throughput_opts.events_in_flight == 0
+                                ? 2 * threads
+                                : throughput_opts.events_in_flight);
+        if (threading_opts.numa_aware) {
+            TRACCC_INFO("Distributing " << threads << " thread(s) between "
+                                        << n_arenas << " NUMA node(s)");
+        }
+    };
+    setup_arenas(thread_counts.front());
+
+    // The full-chain algorithm(s), and their memory resources. One for each
+    // slot, constructed lazily by the thread first using the slot. So that
+    // the memory allocated by the algorithms would be local to the NUMA node
+    // of the thread using them.
+    std::vector<std::unique_ptr<details::event_memory>> memories(n_slots);
+    std::vector<std::unique_ptr<FULL_CHAIN_ALG>> algs(n_slots);
+    auto get_alg = [&](std::size_t slot) -> FULL_CHAIN_ALG& {
+        std::unique_ptr<FULL_CHAIN_ALG>& alg = algs.at(slot);
+        if (!alg) {
+            std::unique_ptr<details::event_memory>& memory = memories.at(slot);
+            memory = std::make_unique<details::event_memory>(
+                host_mr, throughput_opts.event_memory_arena,
+                throughput_opts.memory_statistics);
+            alg = std::make_unique<FULL_CHAIN_ALG>(
+                memory->resource(), clustering_cfg, seedfinder_config,
+                spacepoint_grid_config, seedfilter_config, gbts_config,
+                track_params_estimation_config, finding_cfg, fitting_cfg,
+                det_descr, det_cond, field, &detector, logger().clone(),
+                seeding_gbts_opts.useGBTS);
+            if constexpr (HAS_INTRA_EVENT_PARALLELISM) {
+                alg->set_intra_event_parallelism(
+                    threading_opts.intra_event_parallelism);
+            }
+            memory->checkpoint();
+        }
+        return *alg;
+    };
+
+    // Helper function summing up the memory statistics of all slots.
+    auto memory_totals = [&]() {
+        std::size_t requested = 0, upstream = 0;
+        std::chrono::nanoseconds time{0};
+        for (const std::unique_ptr<details::event_memory>& memory :
+             memories) {
+            if (memory) {
+                requested += memory->requested_allocations();
+                upstream += memory->upstream_allocations();
+                time += memory->upstream_time();
+            }
+        }
+        return std::make_tuple(requested, upstream, time);
+    };
+
+    // Set up the storage for the per-event latencies. With one slot for each
+    // thread, so that they could record their measurements without locking.
+    performance::latency_info latencies{n_slots};
+
+    // Helper function processing one event with a given slot's algorithm,
+    // while recording the event's latency.
+    using stage_inputs = details::stage_inputs_t<FULL_CHAIN_ALG>;
+    auto process_event = [&](std::size_t slot,
+                             const edm::silicon_cell_collection::host& cells,
+                             const stage_inputs* inputs) -> std::size_t {
+        const FULL_CHAIN_ALG& alg = get_alg(slot);
+        performance::timing_info event_times;
+        std::size_t result = 0;
+        {
+            performance::timer t{"Event", event_times};
+            result = details::run_stage(alg, throughput_opts.reco_stage, cells,
+                                        inputs, event_times);
+        }
+        latencies.record(slot, event_times);
+        memories[slot]->end_event();
+        return result;
+    };
 
     // Seed the random number generator.
     if (throughput_opts.random_seed == 0u) {
@@ -218,89 +427,261 @@ int throughput_mt(std::string_view description, int argc, char* argv[]) {
     // optimisations don't skip any step
     std::atomic_size_t rec_track_params = 0;
 
-    // Cold Run events. To discard any "initialisation issues" in the
-    // measurements.
-    {
-        // Set up a progress bar for the warm-up processing.
-        indicators::ProgressBar progress_bar{
-            indicators::option::BarWidth{50},
-            indicators::option::PrefixText{"Warm-up processing "},
-            indicators::option::ShowPercentage{true},
-            indicators::option::ShowRemainingTime{true},
-            indicators::option::MaxProgress{throughput_opts.cold_run_events}};
-
-        // Measure the time of execution.
-        performance::timer t{"Warm-up processing", times};
-
-        // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.cold_run_events; ++i) {
-
-            // Choose which event to process.
-            const std::size_t event =
-                (throughput_opts.deterministic_event_order
-                     ? i
-                     : static_cast<std::size_t>(std::rand())) %
-                input_opts.events;
-
-            // Launch the processing of the event.
-            arena.execute([&, event]() {
-                group.run([&, event]() {
-                    rec_track_params.fetch_add(process_event(
-                        tbb::this_task_arena::current_thread_index(),
-                        input[event]));
-                    progress_bar.tick();
+    // Helper function choosing which event to process in a given iteration.
+    auto choose_event = [&](std::size_t i) -> std::size_t {
+        return (throughput_opts.deterministic_event_order
+                    ? i
+                    : static_cast<std::size_t>(std::rand())) %
+               input_opts.events;
+    };
+
+    // Helper function returning the algorithm slot of the current thread, in
+    // a given arena.
+    auto current_slot = [&](std::size_t arena) {
+        return slot_offsets[arena] +
+               static_cast<std::size_t>(
+                   tbb::this_task_arena::current_thread_index());
+    };
+
+    // Prepare the inputs of the stage being benchmarked, if it needs any.
+    // Using the same algorithm slots that the processing uses later on.
+    std::vector<std::unique_ptr<stage_inputs>> prepared_inputs(input.size());
+    if (details::stage_needs_inputs(throughput_opts.reco_stage)) {
+        performance::timer t{"Stage input preparation", times};
+        for (std::size_t event = 0; event < input.size(); ++event) {
+            const std::size_t a = event % n_arenas;
+            arenas[a]->execute([&, a, event]() {
+                groups[a].run([&, a, event]() {
+                    prepared_inputs[event] = std::make_unique<stage_inputs>(
+                        details::prepare_stage_inputs(
+                            get_alg(current_slot(a)), input[event]));
                 });
             });
         }
-
-        // Wait for all tasks to finish.
-        group.wait();
+        for (std::size_t a = 0; a < n_arenas; ++a) {
+            arenas[a]->execute([&, a]() { groups[a].wait(); });
+        }
+        // Keep the prepared inputs in the event memory arenas.
+        for (std::unique_ptr<details::event_memory>& memory : memories) {
+            if (memory) {
+                memory->checkpoint();
+            }
+        }
     }
+    auto inputs_of = [&](std::size_t event) -> const stage_inputs* {
+        return prepared_inputs[event].get();
+    };
+
+    // Helper function processing a given number of events.
+    auto process_events = [&](std::size_t n_events,
+                              indicators::ProgressBar& progress_bar) {
+        // Choose the events to process up front.
+        std::vector<std::size_t> events(n_events);
+        for (std::size_t i = 0; i < n_events; ++i) {
+            events[i] = choose_event(i);
+        }
+
+        // With LPT scheduling, order the events by their decreasing
+        // predicted cost. Using their number of cells as the estimate.
+        if (throughput_opts.lpt_scheduling) {
+            std::stable_sort(events.begin(), events.end(),
+                             [&](std::size_t lhs, std::size_t rhs) {
+                                 return input[lhs].size() > input[rhs].size();
+                             });
+        }
 
-    // Reset the dummy counter.
-    rec_track_params = 0;
-
-    {
-        // Set up a progress bar for the event processing.
-        indicators::ProgressBar progress_bar{
-            indicators::option::BarWidth{50},
-            indicators::option::PrefixText{"Event processing   "},
-            indicators::option::ShowPercentage{true},
-            indicators::option::ShowRemainingTime{true},
-            indicators::option::MaxProgress{throughput_opts.processed_events}};
-
-        // Measure the total time of execution.
-        performance::timer t{"Event processing", times};
-
-        // Process the requested number of events.
-        for (std::size_t i = 0; i < throughput_opts.processed_events; ++i) {
-
-            // Choose which event to process.
-            const std::size_t event =
-                (throughput_opts.deterministic_event_order
-                     ? i
-                     : static_cast<std::size_t>(std::rand())) %
-                input_opts.events;
-
-            // Launch the processing of the event.
-            arena.execute([&, event]() {
-                group.run([&, event]() {
-                    rec_track_params.fetch_add(process_event(
-                        tbb::this_task_arena::current_thread_index(),
-                        input[event]));
-                    progress_bar.tick();
+        // Distribute the events between the arenas. With LPT scheduling each
+        // event goes to the arena with the lowest predicted load per thread,
+        // otherwise the events are distributed in a round-robin fashion.
+        std::vector<std::vector<std::size_t>> arena_events(n_arenas);
+        std::vector<double> arena_loads(n_arenas, 0.);
+        for (std::size_t i = 0; i < n_events; ++i) {
+            std::size_t a = i % n_arenas;
+            if (throughput_opts.lpt_scheduling) {
+                a = static_cast<std::size_t>(
+                    std::min_element(arena_loads.begin(), arena_loads.end()) -
+                    arena_loads.begin());
+                arena_loads[a] +=
+                    static_cast<double>(input[events[i]].size()) /
+                    static_cast<double>(arenas[a]->max_concurrency());
+            }
+            arena_events[a].push_back(events[i]);
+        }
+        // Index of the next event to process in each arena, with LPT
+        // scheduling.
+        std::vector<std::atomic_size_t> next_event(n_arenas);
+
+        // Helper function processing one event in a given arena.
+        auto process = [&](std::size_t arena,
+                           const edm::silicon_cell_collection::host& cells,
+                           const stage_inputs* inputs) {
+            rec_track_params.fetch_add(
+                process_event(current_slot(arena), cells, inputs));
+            progress_bar.tick();
+        };
+
+        // Helper function streaming the input events of a given arena. The
+        // events are read, processed and released in a pipeline, with a
+        // bounded number of events in flight.
+        auto stream_events = [&](std::size_t arena) {
+            using cells_ptr =
+                std::unique_ptr<edm::silicon_cell_collection::host>;
+            const std::vector<std::size_t>& streamed = arena_events[arena];
+            std::size_t i = 0;
+            const auto select_event = tbb::make_filter<void, std::size_t>(
+                tbb::filter_mode::serial_in_order,
+                [&](tbb::flow_control& fc) -> std::size_t {
+                    if (i >= streamed.size()) {
+                        fc.stop();
+                        return 0u;
+                    }
+                    return input_opts.skip + streamed[i++];
                 });
-            });
+            const auto read_input = tbb::make_filter<std::size_t, cells_ptr>(
+                tbb::filter_mode::parallel, [&](std::size_t event) {
+                    auto cells =
+                        std::make_unique<edm::silicon_cell_collection::host>(
+                            host_mr);
+                    read_event(*cells, event);
+                    return cells;
+                });
+            const auto reconstruct = tbb::make_filter<cells_ptr, void>(
+                tbb::filter_mode::parallel,
+                [&](cells_ptr cells) { process(arena, *cells, nullptr); });
+            tbb::parallel_pipeline(
+                std::max(events_in_flight / n_arenas, std::size_t{1}),
+                select_event & read_input & reconstruct);
+        };
+
+        // Launch the processing in all arenas.
+        for (std::size_t a = 0; a < n_arenas; ++a) {
+            if (throughput_opts.stream_input) {
+                arenas[a]->execute([&, a]() {
+                    groups[a].run([&, a]() { stream_events(a); });
+                });
+            } else if (throughput_opts.lpt_scheduling) {
+                // Let every thread of the arena pick up the next most
+                // expensive event, whenever it finished its previous one.
+                for (int t = 0; t < arenas[a]->max_concurrency(); ++t) {
+                    arenas[a]->execute([&, a]() {
+                        groups[a].run([&, a]() {
+                            const std::vector<std::size_t>& queue =
+                                arena_events[a];
+                            for (std::size_t i = next_event[a]++;
+                                 i < queue.size(); i = next_event[a]++) {
+                                process(a, input[queue[i]],
+                                        inputs_of(queue[i]));
+                            }
+                        });
+                    });
+                }
+            } else {
+                for (std::size_t event : arena_events[a]) {
+                    arenas[a]->execute([&, a, event]() {
+                        groups[a].run([&, a, event]() {
+                            process(a, input[event], inputs_of(event));
+                        });
+                    });
+                }
+            }
         }
 
         // Wait for all tasks to finish.
-        group.wait();
+        for (std::size_t a = 0; a < n_arenas; ++a) {
+            arenas[a]->execute([&, a]() { groups[a].wait(); });
+        }
+    };
+
+    // Measure the throughput with every requested thread count. Keeping the
+    // timing and memory statistics of the last one.
+    std::vector<details::scaling_point> scaling;
+    performance::timing_info point_times;
+    std::size_t warmup_requested = 0, warmup_upstream = 0;
+    std::size_t total_requested = 0, total_upstream = 0;
+    std::chrono::nanoseconds warmup_time{0}, total_time{0};
+    for (std::size_t threads : thread_counts) {
+
+        // Re-create the arena(s), if the thread count changed.
+        if (threads != n_threads) {
+            setup_arenas(threads);
+        }
+        if (thread_counts.size() > 1) {
+            TRACCC_INFO("Measuring the throughput with " << threads
+                                                         << " thread(s)");
+        }
+        point_times = {};
+
+        // Cold Run events. To discard any "initialisation issues" in the
+        // measurements.
+        {
+            // Set up a progress bar for the warm-up processing.
+            indicators::ProgressBar progress_bar{
+                indicators::option::BarWidth{50},
+                indicators::option::PrefixText{"Warm-up processing "},
+                indicators::option::ShowPercentage{true},
+                indicators::option::ShowRemainingTime{true},
+                indicators::option::MaxProgress{
+                    throughput_opts.cold_run_events}};
+
+            // Measure the time of execution.
+            performance::timer t{"Warm-up processing", point_times};
+
+            // Process the requested number of events.
+            process_events(throughput_opts.cold_run_events, progress_bar);
+        }
+
+        // Reset the dummy counter, and forget about the warm-up latencies.
+        rec_track_params = 0;
+        latencies.clear();
+        std::tie(warmup_requested, warmup_upstream, warmup_time) =
+            memory_totals();
+
+        {
+            // Set up a progress bar for the event processing.
+            indicators::ProgressBar progress_bar{
+                indicators::option::BarWidth{50},
+                indicators::option::PrefixText{"Event processing   "},
+                indicators::option::ShowPercentage{true},
+                indicators::option::ShowRemainingTime{true},
+                indicators::option::MaxProgress{
+                    throughput_opts.processed_events}};
+
+            // Measure the total time of execution.
+            performance::timer t{"Event processing", point_times};
+
+            // Process the requested number of events.
+            process_events(throughput_opts.processed_events, progress_bar);
+        }
+
+        // Collect the memory statistics of the event processing.
+        std::tie(total_requested, total_upstream, total_time) =
+            memory_totals();
+
+        // Remember the results of this thread count.
+        scaling.push_back({threads, throughput_opts.processed_events,
+                           point_times.get_time("Warm-up processing"),
+                           point_times.get_time("Event processing")});
     }
+    times.data.insert(times.data.end(), point_times.data.begin(),
+                      point_times.data.end());
 
     // Delete the algorithms explicitly before their parent object would go out
     // of scope.
     algs.clear();
 
+    // Worker processes send their results to the parent process, instead of
+    // printing them.
+    if (workers) {
+        details::worker_report report;
+        report.cold_run_events = throughput_opts.cold_run_events;
+        report.processed_events = throughput_opts.processed_events;
+        report.reconstructed = rec_track_params.load();
+        report.warm_up_time = times.get_time("Warm-up processing");
+        report.processing_time = times.get_time("Event processing");
+        report.latencies = latencies.samples();
+        workers->finish_worker(report);
+    }
+
     // Print some results.
     TRACCC_INFO("Reconstructed track parameters: " << rec_track_params.load());
     TRACCC_INFO("Time totals: " << times);
@@ -311,17 +692,42 @@ int throughput_mt(std::string_view description, int argc, char* argv[]) {
                                           times, "Event processing"};
 
     TRACCC_INFO("Throughput:" << throughput_wu << "\n" << throughput_pr);
+    details::report_latencies(latencies, throughput_opts.log_file, logger());
+    if (throughput_opts.memory_statistics) {
+        const double n_events =
+            static_cast<double>(throughput_opts.processed_events);
+        const double requested =
+            static_cast<double>(total_requested - warmup_requested);
+        const double upstream =
+            static_cast<double>(total_upstream - warmup_upstream);
+        const std::chrono::duration<double, std::micro> time =
+            total_time - warmup_time;
+        TRACCC_INFO("Memory allocations per event: "
+                    << requested / n_events << " requested by the algorithms, "
+                    << upstream / n_events
+                    << " made from the host memory resource, taking "
+                    << time.count() / n_events << " us");
+    }
+    if (thread_counts.size() > 1) {
+        details::report_scaling(scaling, throughput_opts.log_file, logger());
+    }
+    if (throughput_opts.stream_input) {
+        TRACCC_INFO("(Processing times include the reading of the input, with "
+                    << events_in_flight << " events in flight)");
+    }
 
     // Print results to log file
     if (throughput_opts.log_file != "\0") {
         std::ofstream logFile;
         logFile.open(throughput_opts.log_file, std::fstream::app);
-        logFile << "\"" << input_opts.directory << "\""
-                << "," << threading_opts.threads << "," << input_opts.events
-                << "," << throughput_opts.cold_run_events << ","
-                << throughput_opts.processed_events << ","
-                << times.get_time("Warm-up processing").count() << ","
-                << times.get_time("Event processing").count() << std::endl;
+        for (const details::scaling_point& point : scaling) {
+            logFile << "\"" << input_opts.directory << "\""
+                    << "," << point.threads << "," << input_opts.events << ","
+                    << throughput_opts.cold_run_events << ","
+                    << throughput_opts.processed_events << ","
+                    << point.warm_up_time.count() << ","
+                    << point.processing_time.count() << std::endl;
+        }
         logFile.close();
     }
 
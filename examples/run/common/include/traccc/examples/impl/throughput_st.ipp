@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2025 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,7 +8,10 @@
 #pragma once
 
 // Local include(s).
+#include "traccc/examples/event_memory.hpp"
 #include "traccc/examples/make_magnetic_field.hpp"
+#include "traccc/examples/report_latencies.hpp"
+#include "traccc/examples/run_stage.hpp"
 
 // Project include(s)
 #include "traccc/geometry/detector.hpp"
@@ -36,6 +39,8 @@
 #include "traccc/io/utils.hpp"
 
 // Performance measurement include(s).
+#include "traccc/performance/hardware_counters.hpp"
+#include "traccc/performance/latency_info.hpp"
 #include "traccc/performance/throughput.hpp"
 #include "traccc/performance/timer.hpp"
 #include "traccc/performance/timing_info.hpp"
@@ -47,11 +52,14 @@
 #include "traccc/examples/indicators.hpp"
 
 // System include(s).
+#include <chrono>
 #include <cstdlib>
 #include <ctime>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 namespace traccc {
 
@@ -91,13 +99,26 @@ int throughput_st(std::string_view description, int argc, char* argv[]) {
     // Memory resource to use in the test.
     vecmem::host_memory_resource host_mr;
 
+    // Start reading the magnetic field in the background. It is typically the
+    // largest input file, so reading it should not hold up the reading of the
+    // detector and of the events.
+    std::future<magnetic_field> field_future =
+        std::async(std::launch::async,
+                   [&]() { return details::make_magnetic_field(bfield_opts); });
+
     // Construct the detector description object.
     traccc::detector_design_description::host det_descr{host_mr};
     traccc::detector_conditions_description::host det_cond{host_mr};
-    traccc::io::read_detector_description(
-        det_descr, det_cond, detector_opts.detector_file,
-        detector_opts.digitization_file, detector_opts.conditions_file,
-        traccc::data_format::json);
+    if (detector_opts.description_file.empty()) {
+        traccc::io::read_detector_description(
+            det_descr, det_cond, detector_opts.detector_file,
+            detector_opts.digitization_file, detector_opts.conditions_file,
+            traccc::data_format::json);
+    } else {
+        traccc::io::read_detector_description(
+            det_descr, det_cond, detector_opts.description_file, "", "",
+            traccc::data_format::binary);
+    }
 
     // Construct a Detray detector object, if supported by the configuration.
     traccc::host_detector detector;
@@ -105,25 +126,40 @@ int throughput_st(std::string_view description, int argc, char* argv[]) {
                               detector_opts.material_file,
                               detector_opts.grid_file);
 
-    // Construct the magnetic field object.
-    const auto field = details::make_magnetic_field(bfield_opts);
+    // Helper function reading in the cells of a single event.
+    auto read_event = [&](edm::silicon_cell_collection::host& cells,
+                          std::size_t event) {
+        static constexpr bool DEDUPLICATE = true;
+        io::read_cells(cells, event, input_opts.directory, logger().clone(),
+                       &det_cond, input_opts.format, DEDUPLICATE,
+                       input_opts.use_acts_geom_source);
+    };
 
-    // Read in all input events into memory.
+    // Read in all input events into memory, unless they are to be streamed.
     vecmem::vector<edm::silicon_cell_collection::host> input{&host_mr};
-    {
+    if (!throughput_opts.stream_input) {
         performance::timer t{"File reading", times};
         // Read the input cells into memory event-by-event.
         input.reserve(input_opts.events);
         for (std::size_t i = input_opts.skip;
              i < input_opts.skip + input_opts.events; ++i) {
             input.emplace_back(host_mr);
-            static constexpr bool DEDUPLICATE = true;
-            io::read_cells(input.back(), i, input_opts.directory,
-                           logger().clone(), &det_cond, input_opts.format,
-                           DEDUPLICATE, input_opts.use_acts_geom_source);
+            read_event(input.back(), i);
         }
     }
 
+    // Cells of the current event, when streaming the input.
+    edm::silicon_cell_collection::host streamed_cells{host_mr};
+    // Helper function providing the cells of a given event.
+    auto get_event = [&](std::size_t event)
+        -> const edm::silicon_cell_collection::host& {
+        if (throughput_opts.stream_input) {
+            read_event(streamed_cells, input_opts.skip + event);
+            return streamed_cells;
+        }
+        return input[event];
+    };
+
     // Algorithm configuration(s).
     detray::propagation::config propagation_config(propagation_opts);
 
@@ -144,12 +180,28 @@ int throughput_st(std::string_view description, int argc, char* argv[]) {
         fitting_opts);
     fitting_cfg.propagation = propagation_config;
 
+    // Set up the collection of hardware counter values, if requested.
+    if (throughput_opts.hardware_counters &&
+        !performance::hardware_counters::enable()) {
+        TRACCC_WARNING(
+            "Hardware performance counters are not available on this host");
+    }
+
+    // Wait for the magnetic field to be read.
+    const magnetic_field field = field_future.get();
+
+    // Set up the memory resource(s) of the algorithm.
+    details::event_memory memory{host_mr, throughput_opts.event_memory_arena,
+                                 throughput_opts.memory_statistics};
+
     // Set up the full-chain algorithm.
     std::unique_ptr<FULL_CHAIN_ALG> alg = std::make_unique<FULL_CHAIN_ALG>(
-        host_mr, clustering_cfg, seedfinder_config, spacepoint_grid_config,
-        seedfilter_config, gbts_config, track_params_estimation_config,
-        finding_cfg, fitting_cfg, det_descr, det_cond, field, &detector,
-        logger().clone("FullChainAlg"), seeding_gbts_opts.useGBTS);
+        memory.resource(), clustering_cfg, seedfinder_config,
+        spacepoint_grid_config, seedfilter_config, gbts_config,
+        track_params_estimation_config, finding_cfg, fitting_cfg, det_descr,
+        det_cond, field, &detector, logger().clone("FullChainAlg"),
+        seeding_gbts_opts.useGBTS);
+    memory.checkpoint();
 
     // Seed the random number generator.
     if (throughput_opts.random_seed == 0) {
@@ -158,19 +210,41 @@ int throughput_st(std::string_view description, int argc, char* argv[]) {
         std::srand(throughput_opts.random_seed);
     }
 
-    // Set up a lambda that calls the correct function on the algorithm.
-    std::function<std::size_t(const edm::silicon_cell_collection::host&)>
-        process_event;
-    if (throughput_opts.reco_stage == opts::throughput::stage::seeding) {
-        process_event = [&](const edm::silicon_cell_collection::host& cells)
-            -> std::size_t { return alg->seeding(cells).size(); };
-    } else if (throughput_opts.reco_stage == opts::throughput::stage::full) {
-        process_event = [&](const edm::silicon_cell_collection::host& cells)
-            -> std::size_t { return (*alg)(cells).size(); };
-    } else {
-        throw std::invalid_argument("Unknown reconstruction stage");
+    // Set up the storage for the per-event latencies.
+    performance::latency_info latencies;
+
+    // Make sure that the algorithm supports the requested stage.
+    details::check_stage_support<FULL_CHAIN_ALG>(throughput_opts.reco_stage);
+
+    // Prepare the inputs of the stage being benchmarked, if it needs any.
+    using stage_inputs = details::stage_inputs_t<FULL_CHAIN_ALG>;
+    std::vector<std::unique_ptr<stage_inputs>> prepared_inputs(input.size());
+    if (details::stage_needs_inputs(throughput_opts.reco_stage)) {
+        performance::timer t{"Stage input preparation", times};
+        for (std::size_t event = 0; event < input.size(); ++event) {
+            prepared_inputs[event] = std::make_unique<stage_inputs>(
+                details::prepare_stage_inputs(*alg, input[event]));
+        }
+        memory.checkpoint();
     }
 
+    // Helper function processing one event, while recording its latency.
+    auto process_event = [&](std::size_t event) -> std::size_t {
+        const edm::silicon_cell_collection::host& cells = get_event(event);
+        const stage_inputs* inputs =
+            (prepared_inputs.empty() ? nullptr : prepared_inputs[event].get());
+        performance::timing_info event_times;
+        std::size_t result = 0;
+        {
+            performance::timer t{"Event", event_times};
+            result = details::run_stage(*alg, throughput_opts.reco_stage,
+                                        cells, inputs, event_times);
+        }
+        latencies.record(0u, event_times);
+        memory.end_event();
+        return result;
+    };
+
     // Dummy count uses output of tp algorithm to ensure the compiler
     // optimisations don't skip any step
     std::size_t rec_track_params = 0;
@@ -200,13 +274,17 @@ int throughput_st(std::string_view description, int argc, char* argv[]) {
                 input_opts.events;
 
             // Process one event.
-            rec_track_params += process_event(input[event]);
+            rec_track_params += process_event(event);
             progress_bar.tick();
         }
     }
 
-    // Reset the dummy counter.
+    // Reset the dummy counter, and forget about the warm-up latencies.
     rec_track_params = 0;
+    latencies.clear();
+    const std::size_t warmup_requested = memory.requested_allocations();
+    const std::size_t warmup_upstream = memory.upstream_allocations();
+    const std::chrono::nanoseconds warmup_time = memory.upstream_time();
 
     {
         // Set up a progress bar for the event processing.
@@ -231,11 +309,19 @@ int throughput_st(std::string_view description, int argc, char* argv[]) {
                 input_opts.events;
 
             // Process one event.
-            rec_track_params += process_event(input[event]);
+            rec_track_params += process_event(event);
             progress_bar.tick();
         }
     }
 
+    // Collect the memory statistics of the event processing.
+    const double requested = static_cast<double>(
+        memory.requested_allocations() - warmup_requested);
+    const double upstream =
+        static_cast<double>(memory.upstream_allocations() - warmup_upstream);
+    const std::chrono::duration<double, std::micro> time =
+        memory.upstream_time() - warmup_time;
+
     // Explicitly delete the objects in the correct order.
     alg.reset();
 
@@ -251,6 +337,19 @@ int throughput_st(std::string_view description, int argc, char* argv[]) {
               << performance::throughput{throughput_opts.processed_events,
                                          times, "Event processing"}
               << std::endl;
+    details::report_latencies(latencies, throughput_opts.log_file, logger());
+    if (throughput_opts.memory_statistics) {
+        const double n_events =
+            static_cast<double>(throughput_opts.processed_events);
+        std::cout << "Memory allocations per event: " << requested / n_events
+                  << " requested by the algorithm, " << upstream / n_events
+                  << " made from the host memory resource, taking "
+                  << time.count() / n_events << " us" << std::endl;
+    }
+    if (throughput_opts.stream_input) {
+        std::cout << "(Processing times include the reading of the input)"
+                  << std::endl;
+    }
 
     // Return gracefully.
     return 0;
@@ -0,0 +1,166 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/performance/latency_info.hpp"
+#include "traccc/utils/logging.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s).
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace traccc::details {
+
+/// Memory resource allocating from a shared memory segment
+///
+/// The segment is mapped as shared, anonymous memory. So any objects
+/// allocated from it before forking child processes are visible to, and
+/// physically shared with all of those processes. Memory is handed out in a
+/// monotonic fashion, and is only released when the resource is destroyed.
+///
+/// The resource must be "frozen" after forking, since the bookkeeping of
+/// the allocations is not shared between the processes.
+///
+class shared_memory_resource : public vecmem::memory_resource {
+
+    public:
+    /// Constructor with the size of the segment to reserve
+    ///
+    /// Only the used pages of the segment are ever backed by physical memory.
+    /// So the size can be generous.
+    ///
+    /// @param size The size of the shared memory segment
+    ///
+    explicit shared_memory_resource(std::size_t size = (std::size_t{1} << 36));
+    /// Destructor, unmapping the shared memory segment
+    ~shared_memory_resource() override;
+
+    /// Forbid any further allocations from the resource
+    void freeze();
+
+    /// Get the amount of memory allocated from the segment
+    std::size_t used() const;
+
+    private:
+    /// @name Function(s) implementing @c vecmem::memory_resource
+    /// @{
+
+    void* do_allocate(std::size_t size, std::size_t alignment) override;
+    void do_deallocate(void* ptr, std::size_t size,
+                       std::size_t alignment) override;
+    bool do_is_equal(
+        const vecmem::memory_resource& other) const noexcept override;
+
+    /// @}
+
+    /// Pointer to the beginning of the segment
+    std::byte* m_segment = nullptr;
+    /// Size of the segment
+    std::size_t m_size = 0u;
+    /// Offset of the next allocation
+    std::size_t m_offset = 0u;
+    /// Flag showing whether allocations are still allowed
+    bool m_frozen = false;
+    /// Mutex protecting the allocations
+    mutable std::mutex m_mutex;
+
+};  // class shared_memory_resource
+
+/// Results of one throughput worker process
+struct worker_report {
+
+    /// The number of warm-up events processed
+    std::size_t cold_run_events = 0u;
+    /// The number of measured events processed
+    std::size_t processed_events = 0u;
+    /// The number of reconstructed objects
+    std::size_t reconstructed = 0u;
+    /// The time taken by the warm-up processing
+    std::chrono::nanoseconds warm_up_time{0};
+    /// The time taken by the measured event processing
+    std::chrono::nanoseconds processing_time{0};
+    /// The recorded latencies of the worker
+    std::vector<std::pair<std::string, std::vector<std::chrono::nanoseconds>>>
+        latencies;
+
+};  // struct worker_report
+
+/// Pool of forked throughput worker processes
+///
+/// The constructor forks the requested number of worker processes. Both the
+/// parent and the worker processes return from the constructor. The workers
+/// must finish with @c finish_worker, and the parent must collect the
+/// workers' results with @c collect.
+///
+class process_pool {
+
+    public:
+    /// Constructor, forking the worker processes
+    ///
+    /// @param n_workers The number of worker processes to fork
+    /// @param pin       Whether to pin each worker to one NUMA node (socket)
+    ///                  of the host, in a round-robin fashion
+    ///
+    process_pool(std::size_t n_workers, bool pin);
+    /// Destructor
+    ~process_pool();
+
+    /// Check if this is the parent process
+    bool is_parent() const;
+    /// Get the index of the current worker process
+    std::size_t worker_index() const;
+
+    /// Send the results of a worker process to the parent, and exit
+    ///
+    /// @param report The results of the worker
+    ///
+    [[noreturn]] void finish_worker(const worker_report& report);
+
+    /// Wait for all workers to finish, and collect their results
+    ///
+    /// All of the workers are waited for, even if some of them failed. In
+    /// which case an exception naming the first failed worker is thrown.
+    ///
+    /// @return The results of all of the workers
+    ///
+    std::vector<worker_report> collect();
+
+    private:
+    /// The index of the current worker (or the number of workers in the
+    /// parent process)
+    std::size_t m_worker_index = 0u;
+    /// The process IDs of the workers (in the parent process)
+    std::vector<int> m_pids;
+    /// The (reading or writing) ends of the pipes to/from the workers
+    std::vector<int> m_pipes;
+
+};  // class process_pool
+
+/// Print, and optionally log, the aggregated results of worker processes
+///
+/// @param reports    The results of the worker processes
+/// @param threads    The number of threads used per worker process
+/// @param input_dir  The input directory of the job
+/// @param n_events   The number of input events of the job
+/// @param log_file   The name of the throughput log file (may be empty)
+/// @param log        The logger to use for printing the results
+///
+void report_workers(const std::vector<worker_report>& reports,
+                    std::size_t threads, const std::string& input_dir,
+                    std::size_t n_events, const std::string& log_file,
+                    const Logger& log);
+
+}  // namespace traccc::details
@@ -0,0 +1,36 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/performance/latency_info.hpp"
+#include "traccc/utils/logging.hpp"
+
+// System include(s).
+#include <string_view>
+
+namespace traccc::details {
+
+/// Print, and optionally save, the latency distributions of a throughput job
+///
+/// When a log file name is given, the summaries are also written into
+/// <tt>&lt;log file stem&gt;.latency.csv</tt> and
+/// <tt>&lt;log file stem&gt;.latency.json</tt>, next to the log file.
+///
+/// If hardware counter values were recorded with the latencies, those are
+/// printed as well, and written into
+/// <tt>&lt;log file stem&gt;.counters.csv</tt> when a log file name is given.
+///
+/// @param latencies The latencies recorded during the job
+/// @param log_file  The name of the throughput log file (may be empty)
+/// @param log       The logger to use for printing the summaries
+///
+void report_latencies(const performance::latency_info& latencies,
+                      std::string_view log_file, const Logger& log);
+
+}  // namespace traccc::details
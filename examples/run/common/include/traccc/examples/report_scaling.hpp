@@ -0,0 +1,78 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/utils/logging.hpp"
+
+// System include(s).
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace traccc::details {
+
+/// Throughput measurement with one thread count, in a thread scaling sweep
+struct scaling_point {
+    /// The number of threads used
+    std::size_t threads = 0;
+    /// The number of processed events
+    std::size_t events = 0;
+    /// The time taken by the warm-up processing
+    std::chrono::nanoseconds warm_up_time{0};
+    /// The time taken by the event processing
+    std::chrono::nanoseconds processing_time{0};
+};
+
+/// Result of fitting Amdahl's law to a thread scaling sweep
+///
+/// The processing time of one event is modeled as
+/// <tt>T(n) = T(1) * (s + (1 - s) / n)</tt>, with @c s being the serial
+/// fraction of the processing.
+///
+struct amdahl_fit {
+    /// The (extrapolated) single-threaded processing time of one event
+    std::chrono::duration<double> single_thread_time{0.};
+    /// The serial fraction of the processing
+    double serial_fraction = 0.;
+
+    /// Predicted throughput (events/s) with a given number of threads
+    double throughput(std::size_t threads) const;
+    /// Predicted upper limit on the speedup (1 / serial fraction)
+    double max_speedup() const;
+};
+
+/// Fit Amdahl's law to the points of a thread scaling sweep
+///
+/// Performs a least-squares fit of the per-event processing time as a
+/// linear function of <tt>1 / threads</tt>.
+///
+/// @param points The measurements of the sweep
+/// @return The fit result
+///
+/// @throw std::invalid_argument If there are fewer than two different thread
+///                              counts in the sweep
+///
+amdahl_fit fit_amdahl(const std::vector<scaling_point>& points);
+
+/// Print, and optionally save, the results of a thread scaling sweep
+///
+/// The speedup and the parallel efficiency of every point are calculated
+/// relative to the point with the lowest thread count. When a log file name
+/// is given, the table is also written into
+/// <tt>&lt;log file stem&gt;.scaling.csv</tt>, next to the log file.
+///
+/// @param points   The measurements of the sweep
+/// @param log_file The name of the throughput log file (may be empty)
+/// @param log      The logger to use for printing the table
+///
+void report_scaling(const std::vector<scaling_point>& points,
+                    std::string_view log_file, const Logger& log);
+
+}  // namespace traccc::details
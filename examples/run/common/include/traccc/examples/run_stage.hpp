@@ -0,0 +1,162 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/edm/silicon_cell_collection.hpp"
+#include "traccc/options/throughput.hpp"
+#include "traccc/performance/timing_info.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <stdexcept>
+#include <variant>
+
+namespace traccc::details {
+
+/// Full chain algorithms that can time their reconstruction stages
+template <typename FULL_CHAIN_ALG>
+concept has_stage_times =
+    requires(const FULL_CHAIN_ALG& alg,
+             const edm::silicon_cell_collection::host& cells,
+             performance::timing_info& stage_times) {
+        alg(cells, stage_times);
+        alg.seeding(cells, stage_times);
+    };
+
+/// Full chain algorithms that can benchmark their stages in isolation
+template <typename FULL_CHAIN_ALG>
+concept has_stage_benchmarks = requires(
+    const FULL_CHAIN_ALG& alg, const edm::silicon_cell_collection::host& cells,
+    const typename FULL_CHAIN_ALG::stage_inputs& inputs,
+    performance::timing_info& stage_times) {
+    alg.run_clusterization(cells, stage_times);
+    alg.run_spacepoint_formation(cells, stage_times);
+    alg.prepare_stage_inputs(cells);
+    alg.run_track_finding(inputs, stage_times);
+    alg.run_track_fitting(inputs, stage_times);
+    alg.run_ambiguity_resolution(inputs, stage_times);
+};
+
+/// The type of the prepared stage inputs of a full chain algorithm
+template <typename FULL_CHAIN_ALG>
+struct stage_inputs_type {
+    using type = std::monostate;
+};
+/// The type of the prepared stage inputs of a full chain algorithm
+template <typename FULL_CHAIN_ALG>
+requires has_stage_benchmarks<FULL_CHAIN_ALG> struct stage_inputs_type<
+    FULL_CHAIN_ALG> {
+    using type = typename FULL_CHAIN_ALG::stage_inputs;
+};
+/// The type of the prepared stage inputs of a full chain algorithm
+template <typename FULL_CHAIN_ALG>
+using stage_inputs_t = typename stage_inputs_type<FULL_CHAIN_ALG>::type;
+
+/// Check whether a stage runs on prepared inputs
+///
+/// @param stage The reconstruction stage to check
+/// @return @c true if the stage needs inputs prepared before the warm-up
+///
+inline bool stage_needs_inputs(opts::throughput::stage stage) {
+
+    return (stage == opts::throughput::stage::track_finding) ||
+           (stage == opts::throughput::stage::track_fitting) ||
+           (stage == opts::throughput::stage::ambiguity_resolution);
+}
+
+/// Check whether a full chain algorithm supports a given stage
+///
+/// @param stage The reconstruction stage to check
+/// @throws std::invalid_argument if the stage is not supported
+///
+template <typename FULL_CHAIN_ALG>
+void check_stage_support(opts::throughput::stage stage) {
+
+    if ((stage != opts::throughput::stage::seeding) &&
+        (stage != opts::throughput::stage::full) &&
+        !has_stage_benchmarks<FULL_CHAIN_ALG>) {
+        throw std::invalid_argument(
+            "Reconstruction stage not supported by this algorithm");
+    }
+}
+
+/// Prepare the inputs of the stages that need them, for one event
+///
+/// @param alg   The full chain algorithm to use
+/// @param cells The cells of the event
+/// @return The prepared inputs of the event
+///
+template <typename FULL_CHAIN_ALG>
+stage_inputs_t<FULL_CHAIN_ALG> prepare_stage_inputs(
+    const FULL_CHAIN_ALG& alg,
+    [[maybe_unused]] const edm::silicon_cell_collection::host& cells) {
+
+    if constexpr (has_stage_benchmarks<FULL_CHAIN_ALG>) {
+        return alg.prepare_stage_inputs(cells);
+    } else {
+        throw std::invalid_argument(
+            "Stage inputs not supported by this algorithm");
+    }
+}
+
+/// Run one (or more) reconstruction stage(s) on an event
+///
+/// @param alg         The full chain algorithm to use
+/// @param stage       The reconstruction stage to run
+/// @param cells       The cells of the event
+/// @param inputs      The prepared inputs of the event (if needed)
+/// @param stage_times Timing information for the reconstruction stages
+/// @return The number of objects produced by the (last) stage
+///
+template <typename FULL_CHAIN_ALG>
+std::size_t run_stage(
+    const FULL_CHAIN_ALG& alg, opts::throughput::stage stage,
+    const edm::silicon_cell_collection::host& cells,
+    [[maybe_unused]] const stage_inputs_t<FULL_CHAIN_ALG>* inputs,
+    [[maybe_unused]] performance::timing_info& stage_times) {
+
+    using enum opts::throughput::stage;
+
+    // Run the stages only supported by some of the algorithms.
+    if constexpr (has_stage_benchmarks<FULL_CHAIN_ALG>) {
+        switch (stage) {
+            case clusterization:
+                return alg.run_clusterization(cells, stage_times);
+            case spacepoint_formation:
+                return alg.run_spacepoint_formation(cells, stage_times);
+            case track_finding:
+                return alg.run_track_finding(*inputs, stage_times);
+            case track_fitting:
+                return alg.run_track_fitting(*inputs, stage_times);
+            case ambiguity_resolution:
+                return alg.run_ambiguity_resolution(*inputs, stage_times);
+            default:
+                break;
+        }
+    }
+
+    // Run the stages supported by all algorithms.
+    if (stage == seeding) {
+        if constexpr (has_stage_times<FULL_CHAIN_ALG>) {
+            return alg.seeding(cells, stage_times).size();
+        } else {
+            return alg.seeding(cells).size();
+        }
+    } else if (stage == full) {
+        if constexpr (has_stage_times<FULL_CHAIN_ALG>) {
+            return alg(cells, stage_times).size();
+        } else {
+            return alg(cells).size();
+        }
+    }
+    throw std::invalid_argument(
+        "Reconstruction stage not supported by this algorithm");
+}
+
+}  // namespace traccc::details
@@ -0,0 +1,182 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/examples/event_memory.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstdint>
+
+namespace traccc::details {
+
+counting_memory_resource::counting_memory_resource(
+    vecmem::memory_resource& upstream)
+    : m_upstream(upstream) {}
+
+std::size_t counting_memory_resource::allocations() const {
+
+    return m_allocations.load();
+}
+
+std::chrono::nanoseconds counting_memory_resource::time() const {
+
+    return std::chrono::nanoseconds{m_time.load()};
+}
+
+void* counting_memory_resource::do_allocate(std::size_t size,
+                                            std::size_t alignment) {
+
+    const auto start = std::chrono::steady_clock::now();
+    void* result = m_upstream.allocate(size, alignment);
+    const auto end = std::chrono::steady_clock::now();
+    m_allocations.fetch_add(1u, std::memory_order_relaxed);
+    m_time.fetch_add((end - start).count(), std::memory_order_relaxed);
+    return result;
+}
+
+void counting_memory_resource::do_deallocate(void* ptr, std::size_t size,
+                                             std::size_t alignment) {
+
+    const auto start = std::chrono::steady_clock::now();
+    m_upstream.deallocate(ptr, size, alignment);
+    const auto end = std::chrono::steady_clock::now();
+    m_time.fetch_add((end - start).count(), std::memory_order_relaxed);
+}
+
+bool counting_memory_resource::do_is_equal(
+    const vecmem::memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+event_memory_resource::event_memory_resource(vecmem::memory_resource& upstream,
+                                             std::size_t block_size)
+    : m_upstream(upstream), m_next_block_size(block_size) {}
+
+event_memory_resource::~event_memory_resource() {
+
+    for (const block& b : m_blocks) {
+        m_upstream.deallocate(b.m_ptr, b.m_size);
+    }
+}
+
+void event_memory_resource::checkpoint() {
+
+    m_checkpoint = m_current;
+}
+
+void event_memory_resource::reset() {
+
+    m_current = m_checkpoint;
+}
+
+std::size_t event_memory_resource::allocations() const {
+
+    return m_allocations;
+}
+
+void* event_memory_resource::do_allocate(std::size_t size,
+                                         std::size_t alignment) {
+
+    ++m_allocations;
+
+    // Look for space in the current block, or any block after it. Allocating
+    // a new block if none of the existing ones have enough space left.
+    while (true) {
+        if (m_current.m_block == m_blocks.size()) {
+            const std::size_t block_size =
+                std::max(m_next_block_size, size + alignment);
+            m_blocks.push_back(
+                {static_cast<std::byte*>(m_upstream.allocate(block_size)),
+                 block_size});
+            m_next_block_size = 2u * block_size;
+        }
+        const block& b = m_blocks[m_current.m_block];
+        const std::uintptr_t begin =
+            reinterpret_cast<std::uintptr_t>(b.m_ptr) + m_current.m_offset;
+        const std::uintptr_t aligned =
+            (begin + alignment - 1u) & ~(std::uintptr_t{alignment} - 1u);
+        const std::size_t offset =
+            m_current.m_offset + static_cast<std::size_t>(aligned - begin);
+        if (offset + size <= b.m_size) {
+            m_current.m_offset = offset + size;
+            return b.m_ptr + offset;
+        }
+        ++m_current.m_block;
+        m_current.m_offset = 0u;
+    }
+}
+
+void event_memory_resource::do_deallocate(void*, std::size_t, std::size_t) {
+
+    // Memory is only released by the resets.
+}
+
+bool event_memory_resource::do_is_equal(
+    const vecmem::memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+event_memory::event_memory(vecmem::memory_resource& upstream, bool use_arena,
+                           bool count)
+    : m_upstream(upstream) {
+
+    if (count) {
+        m_counting = std::make_unique<counting_memory_resource>(m_upstream);
+    }
+    if (use_arena) {
+        m_arena = std::make_unique<event_memory_resource>(
+            m_counting ? *m_counting : m_upstream);
+    }
+}
+
+vecmem::memory_resource& event_memory::resource() {
+
+    if (m_arena) {
+        return *m_arena;
+    }
+    if (m_counting) {
+        return *m_counting;
+    }
+    return m_upstream;
+}
+
+void event_memory::checkpoint() {
+
+    if (m_arena) {
+        m_arena->checkpoint();
+    }
+}
+
+void event_memory::end_event() {
+
+    if (m_arena) {
+        m_arena->reset();
+    }
+}
+
+std::size_t event_memory::requested_allocations() const {
+
+    if (m_arena) {
+        return m_arena->allocations();
+    }
+    return upstream_allocations();
+}
+
+std::size_t event_memory::upstream_allocations() const {
+
+    return (m_counting ? m_counting->allocations() : 0u);
+}
+
+std::chrono::nanoseconds event_memory::upstream_time() const {
+
+    return (m_counting ? m_counting->time() : std::chrono::nanoseconds{0});
+}
+
+}  // namespace traccc::details
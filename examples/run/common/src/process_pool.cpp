@@ -0,0 +1,421 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/examples/process_pool.hpp"
+
+// Project include(s).
+#include "traccc/examples/report_latencies.hpp"
+
+// System include(s).
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace traccc::details {
+namespace {
+
+/// Parse a Linux CPU/node list (like "0-3,8,10-11")
+std::vector<int> parse_list(const std::string& list) {
+
+    std::vector<int> result;
+    std::istringstream stream{list};
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        const std::size_t dash = range.find('-');
+        const int first = std::stoi(range.substr(0, dash));
+        const int last = (dash == std::string::npos)
+                             ? first
+                             : std::stoi(range.substr(dash + 1));
+        for (int i = first; i <= last; ++i) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+/// Read the first line of a (sysfs) file, returning an empty string on error
+std::string read_line(const std::string& file_name) {
+
+    std::ifstream file{file_name};
+    std::string result;
+    std::getline(file, result);
+    return result;
+}
+
+/// Pin the current process to the CPUs of one of the host's NUMA nodes
+void pin_to_numa_node(std::size_t index) {
+
+    const std::vector<int> nodes =
+        parse_list(read_line("/sys/devices/system/node/online"));
+    if (nodes.empty()) {
+        std::cerr << "WARNING: Could not determine the NUMA nodes of the host"
+                  << std::endl;
+        return;
+    }
+    const int node = nodes[index % nodes.size()];
+    const std::vector<int> cpus = parse_list(read_line(
+        "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : cpus) {
+        CPU_SET(cpu, &cpu_set);
+    }
+    if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+        throw std::system_error(errno, std::generic_category(),
+                                "Could not pin worker process");
+    }
+}
+
+/// Write a buffer completely into a file descriptor
+void write_all(int fd, const void* data, std::size_t size) {
+
+    const char* ptr = static_cast<const char*>(data);
+    while (size > 0) {
+        const ssize_t written = ::write(fd, ptr, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(),
+                                    "Could not send worker results");
+        }
+        ptr += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+/// Read a buffer completely from a file descriptor
+void read_all(int fd, void* data, std::size_t size) {
+
+    char* ptr = static_cast<char*>(data);
+    while (size > 0) {
+        const ssize_t n_read = ::read(fd, ptr, size);
+        if (n_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n_read < 0) {
+            throw std::system_error(errno, std::generic_category(),
+                                    "Could not receive worker results");
+        }
+        if (n_read == 0) {
+            throw std::runtime_error("Worker results ended prematurely");
+        }
+        ptr += n_read;
+        size -= static_cast<std::size_t>(n_read);
+    }
+}
+
+/// Write an integer into a file descriptor
+void write_int(int fd, std::int64_t value) {
+
+    write_all(fd, &value, sizeof(value));
+}
+
+/// Read an integer from a file descriptor
+std::int64_t read_int(int fd) {
+
+    std::int64_t value = 0;
+    read_all(fd, &value, sizeof(value));
+    return value;
+}
+
+/// Read the results of one worker from a file descriptor
+worker_report read_report(int fd) {
+
+    worker_report report;
+    report.cold_run_events = static_cast<std::size_t>(read_int(fd));
+    report.processed_events = static_cast<std::size_t>(read_int(fd));
+    report.reconstructed = static_cast<std::size_t>(read_int(fd));
+    report.warm_up_time = std::chrono::nanoseconds{read_int(fd)};
+    report.processing_time = std::chrono::nanoseconds{read_int(fd)};
+    const auto n_components = static_cast<std::size_t>(read_int(fd));
+    for (std::size_t j = 0; j < n_components; ++j) {
+        std::string name(static_cast<std::size_t>(read_int(fd)), '\0');
+        read_all(fd, name.data(), name.size());
+        std::vector<std::chrono::nanoseconds> latencies(
+            static_cast<std::size_t>(read_int(fd)));
+        read_all(fd, latencies.data(),
+                 latencies.size() * sizeof(std::chrono::nanoseconds));
+        report.latencies.emplace_back(std::move(name), std::move(latencies));
+    }
+    return report;
+}
+
+/// Describe how a worker process ended, based on its @c waitpid status
+std::string describe_status(int status) {
+
+    if (WIFEXITED(status)) {
+        return "exited with status " + std::to_string(WEXITSTATUS(status));
+    }
+    if (WIFSIGNALED(status)) {
+        return "killed by signal " + std::to_string(WTERMSIG(status)) + " (" +
+               ::strsignal(WTERMSIG(status)) + ")";
+    }
+    return "ended with unknown status " + std::to_string(status);
+}
+
+}  // namespace
+
+shared_memory_resource::shared_memory_resource(std::size_t size)
+    : m_size(size) {
+
+    void* segment = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (segment == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(),
+                                "Could not map shared memory segment");
+    }
+    m_segment = static_cast<std::byte*>(segment);
+}
+
+shared_memory_resource::~shared_memory_resource() {
+
+    ::munmap(m_segment, m_size);
+}
+
+void shared_memory_resource::freeze() {
+
+    std::lock_guard lock{m_mutex};
+    m_frozen = true;
+}
+
+std::size_t shared_memory_resource::used() const {
+
+    std::lock_guard lock{m_mutex};
+    return m_offset;
+}
+
+void* shared_memory_resource::do_allocate(std::size_t size,
+                                          std::size_t alignment) {
+
+    std::lock_guard lock{m_mutex};
+    if (m_frozen) {
+        throw std::logic_error(
+            "Allocation from a frozen shared memory resource");
+    }
+    const std::size_t offset =
+        (m_offset + alignment - 1u) & ~(alignment - 1u);
+    if (offset + size > m_size) {
+        throw std::bad_alloc();
+    }
+    m_offset = offset + size;
+    return m_segment + offset;
+}
+
+void shared_memory_resource::do_deallocate(void*, std::size_t, std::size_t) {
+
+    // Memory is only released when the segment is unmapped.
+}
+
+bool shared_memory_resource::do_is_equal(
+    const vecmem::memory_resource& other) const noexcept {
+
+    return (this == &other);
+}
+
+process_pool::process_pool(std::size_t n_workers, bool pin)
+    : m_worker_index(n_workers) {
+
+    // Make sure that nothing buffered would be written out multiple times.
+    std::cout.flush();
+    std::cerr.flush();
+
+    for (std::size_t i = 0; i < n_workers; ++i) {
+        int fds[2];
+        if (::pipe(fds) != 0) {
+            throw std::system_error(errno, std::generic_category(),
+                                    "Could not create pipe");
+        }
+        const pid_t pid = ::fork();
+        if (pid < 0) {
+            throw std::system_error(errno, std::generic_category(),
+                                    "Could not fork worker process");
+        }
+        if (pid == 0) {
+            // In the worker, only keep the writing end of its own pipe.
+            for (int fd : m_pipes) {
+                ::close(fd);
+            }
+            ::close(fds[0]);
+            m_pipes = {fds[1]};
+            m_pids.clear();
+            m_worker_index = i;
+            if (pin) {
+                pin_to_numa_node(i);
+            }
+            return;
+        }
+        // In the parent, keep the reading end of the pipe.
+        ::close(fds[1]);
+        m_pipes.push_back(fds[0]);
+        m_pids.push_back(pid);
+    }
+}
+
+process_pool::~process_pool() {
+
+    for (int fd : m_pipes) {
+        ::close(fd);
+    }
+}
+
+bool process_pool::is_parent() const {
+
+    return m_worker_index == m_pids.size() && !m_pids.empty();
+}
+
+std::size_t process_pool::worker_index() const {
+
+    return m_worker_index;
+}
+
+void process_pool::finish_worker(const worker_report& report) {
+
+    int exit_code = EXIT_SUCCESS;
+    try {
+        const int fd = m_pipes.at(0);
+        write_int(fd, static_cast<std::int64_t>(report.cold_run_events));
+        write_int(fd, static_cast<std::int64_t>(report.processed_events));
+        write_int(fd, static_cast<std::int64_t>(report.reconstructed));
+        write_int(fd, report.warm_up_time.count());
+        write_int(fd, report.processing_time.count());
+        write_int(fd, static_cast<std::int64_t>(report.latencies.size()));
+        for (const auto& [name, latencies] : report.latencies) {
+            write_int(fd, static_cast<std::int64_t>(name.size()));
+            write_all(fd, name.data(), name.size());
+            write_int(fd, static_cast<std::int64_t>(latencies.size()));
+            write_all(fd, latencies.data(),
+                      latencies.size() * sizeof(std::chrono::nanoseconds));
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << "Worker " << m_worker_index << ": " << ex.what()
+                  << std::endl;
+        exit_code = EXIT_FAILURE;
+    }
+    std::cout.flush();
+    std::cerr.flush();
+    // Exit without running the destructors of objects shared with the
+    // parent process.
+    std::_Exit(exit_code);
+}
+
+std::vector<worker_report> process_pool::collect() {
+
+    // Receive the results of all workers first. Without giving up on the
+    // first failure, so that all of the workers would be waited for below.
+    std::vector<worker_report> result(m_pids.size());
+    std::vector<std::string> errors(m_pids.size());
+    for (std::size_t i = 0; i < m_pids.size(); ++i) {
+        try {
+            result[i] = read_report(m_pipes[i]);
+        } catch (const std::exception& ex) {
+            errors[i] = ex.what();
+        }
+    }
+
+    // Reap all of the worker processes.
+    std::vector<int> statuses(m_pids.size(), 0);
+    for (std::size_t i = 0; i < m_pids.size(); ++i) {
+        while (::waitpid(m_pids[i], &statuses[i], 0) < 0) {
+            if (errno != EINTR) {
+                if (errors[i].empty()) {
+                    errors[i] = std::strerror(errno);
+                }
+                break;
+            }
+        }
+    }
+
+    // Report the first worker that failed.
+    for (std::size_t i = 0; i < m_pids.size(); ++i) {
+        const bool exited_ok = (WIFEXITED(statuses[i]) &&
+                                WEXITSTATUS(statuses[i]) == EXIT_SUCCESS);
+        if (!exited_ok || !errors[i].empty()) {
+            std::string message = "Worker process " + std::to_string(i) +
+                                  " (pid " + std::to_string(m_pids[i]) +
+                                  ") failed: " + describe_status(statuses[i]);
+            if (!errors[i].empty()) {
+                message += " (" + errors[i] + ")";
+            }
+            throw std::runtime_error(message);
+        }
+    }
+    return result;
+}
+
+void report_workers(const std::vector<worker_report>& reports,
+                    std::size_t threads, const std::string& input_dir,
+                    std::size_t n_events, const std::string& log_file,
+                    const Logger& log) {
+
+    auto logger = [&log]() -> const Logger& { return log; };
+
+    // Print the results of the individual workers, and sum them up.
+    std::ostringstream printout;
+    worker_report total;
+    double total_rate = 0.;
+    performance::latency_info latencies;
+    for (std::size_t i = 0; i < reports.size(); ++i) {
+        const worker_report& report = reports[i];
+        const double seconds =
+            std::chrono::duration<double>(report.processing_time).count();
+        const double rate =
+            static_cast<double>(report.processed_events) / seconds;
+        printout << "\n  Worker " << i << ": " << report.processed_events
+                 << " events in " << seconds << " s (" << rate
+                 << " events/s)";
+        total_rate += rate;
+        total.cold_run_events += report.cold_run_events;
+        total.processed_events += report.processed_events;
+        total.reconstructed += report.reconstructed;
+        total.warm_up_time = std::max(total.warm_up_time, report.warm_up_time);
+        total.processing_time =
+            std::max(total.processing_time, report.processing_time);
+        for (const auto& [name, samples] : report.latencies) {
+            for (const std::chrono::nanoseconds latency : samples) {
+                latencies.record(0u, name, latency);
+            }
+        }
+    }
+    TRACCC_INFO("Reconstructed track parameters: " << total.reconstructed);
+    TRACCC_INFO("Throughput of " << reports.size() << " worker processes:"
+                                 << printout.str() << "\n  Total: "
+                                 << total_rate << " events/s");
+    report_latencies(latencies, log_file, log);
+
+    // Log the aggregated results, with the slowest worker's times.
+    if (!log_file.empty()) {
+        std::ofstream log_stream{log_file, std::fstream::app};
+        log_stream << "\"" << input_dir << "\"," << threads * reports.size()
+                   << "," << n_events << "," << total.cold_run_events << ","
+                   << total.processed_events << ","
+                   << total.warm_up_time.count() << ","
+                   << total.processing_time.count() << std::endl;
+    }
+}
+
+}  // namespace traccc::details
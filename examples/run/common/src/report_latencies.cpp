@@ -0,0 +1,97 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/examples/report_latencies.hpp"
+
+// System include(s).
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace traccc::details {
+
+void report_latencies(const performance::latency_info& latencies,
+                      std::string_view log_file, const Logger& log) {
+
+    const std::vector<performance::latency_summary> summaries =
+        latencies.summarize();
+
+    auto logger = [&log]() -> const Logger& { return log; };
+    std::ostringstream printout;
+    for (const performance::latency_summary& summary : summaries) {
+        printout << "\n" << summary;
+    }
+    TRACCC_INFO("Latencies:" << printout.str());
+
+    // Print the hardware counter values, if there are any.
+    const std::vector<performance::counter_info_pair> counters =
+        latencies.counters();
+    if (!counters.empty()) {
+        std::ostringstream counter_printout;
+        for (const auto& [name, counts] : counters) {
+            counter_printout << "\n"
+                             << std::setw(30) << std::right << name << "  "
+                             << counts;
+        }
+        TRACCC_INFO("Hardware counters:" << counter_printout.str());
+    }
+
+    // Stop here if no log file was requested.
+    if (log_file.empty()) {
+        return;
+    }
+
+    // Write the summaries next to the log file.
+    std::filesystem::path csv_path{log_file};
+    csv_path.replace_extension(".latency.csv");
+    std::filesystem::path json_path{log_file};
+    json_path.replace_extension(".latency.json");
+
+    std::ofstream csv_file(csv_path);
+    if (!csv_file.good()) {
+        throw std::runtime_error("Could not open file: " + csv_path.string());
+    }
+    performance::write_csv(csv_file, summaries);
+
+    std::ofstream json_file(json_path);
+    if (!json_file.good()) {
+        throw std::runtime_error("Could not open file: " + json_path.string());
+    }
+    performance::write_json(json_file, summaries);
+
+    TRACCC_INFO("Wrote latency summaries into " << csv_path << " and "
+                                                << json_path);
+
+    // Write the hardware counter values next to the log file, if there are
+    // any.
+    if (counters.empty()) {
+        return;
+    }
+    std::filesystem::path counters_path{log_file};
+    counters_path.replace_extension(".counters.csv");
+    std::ofstream counters_file(counters_path);
+    if (!counters_file.good()) {
+        throw std::runtime_error("Could not open file: " +
+                                 counters_path.string());
+    }
+    counters_file << "name,cycles,instructions,cache_misses,branch_misses,"
+                     "ipc,cache_mpki,branch_mpki\n";
+    for (const auto& [name, counts] : counters) {
+        counters_file << "\"" << name << "\"," << counts.cycles << ","
+                      << counts.instructions << "," << counts.cache_misses
+                      << "," << counts.branch_misses << "," << counts.ipc()
+                      << "," << counts.cache_mpki() << ","
+                      << counts.branch_mpki() << "\n";
+    }
+    TRACCC_INFO("Wrote hardware counter values into " << counters_path);
+}
+
+}  // namespace traccc::details
@@ -0,0 +1,157 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/examples/report_scaling.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace traccc::details {
+namespace {
+
+/// Get the (wall-clock) processing time of one event, in seconds
+double time_per_event(const scaling_point& point) {
+
+    return std::chrono::duration<double>(point.processing_time).count() /
+           static_cast<double>(point.events);
+}
+
+}  // namespace
+
+double amdahl_fit::throughput(std::size_t threads) const {
+
+    return 1. / (single_thread_time.count() *
+                 (serial_fraction +
+                  (1. - serial_fraction) / static_cast<double>(threads)));
+}
+
+double amdahl_fit::max_speedup() const {
+
+    return (serial_fraction > 0. ? 1. / serial_fraction
+                                 : std::numeric_limits<double>::infinity());
+}
+
+amdahl_fit fit_amdahl(const std::vector<scaling_point>& points) {
+
+    // Fit T = a + b * x, with x = 1 / threads.
+    double sum_x = 0., sum_y = 0., sum_xx = 0., sum_xy = 0.;
+    for (const scaling_point& point : points) {
+        const double x = 1. / static_cast<double>(point.threads);
+        const double y = time_per_event(point);
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+    }
+    const double n = static_cast<double>(points.size());
+    const double denominator = n * sum_xx - sum_x * sum_x;
+    if ((points.size() < 2) ||
+        (denominator <= std::numeric_limits<double>::epsilon() * n * sum_xx)) {
+        throw std::invalid_argument(
+            "At least two different thread counts are needed for a fit");
+    }
+    const double b = (n * sum_xy - sum_x * sum_y) / denominator;
+    const double a = (sum_y - b * sum_x) / n;
+
+    // Translate the parameters into Amdahl's law. Keeping the serial fraction
+    // physical, even if the measurements are noisy.
+    amdahl_fit result;
+    result.single_thread_time = std::chrono::duration<double>{a + b};
+    result.serial_fraction = std::clamp(a / (a + b), 0., 1.);
+    return result;
+}
+
+void report_scaling(const std::vector<scaling_point>& points,
+                    std::string_view log_file, const Logger& log) {
+
+    auto logger = [&log]() -> const Logger& { return log; };
+    if (points.empty()) {
+        return;
+    }
+
+    // The reference point, that the speedups are calculated relative to.
+    const scaling_point& reference = *std::min_element(
+        points.begin(), points.end(),
+        [](const scaling_point& lhs, const scaling_point& rhs) {
+            return lhs.threads < rhs.threads;
+        });
+
+    // Fit Amdahl's law, if there are enough different thread counts.
+    const bool has_fit = std::any_of(
+        points.begin(), points.end(), [&reference](const scaling_point& p) {
+            return p.threads != reference.threads;
+        });
+    const amdahl_fit fit = (has_fit ? fit_amdahl(points) : amdahl_fit{});
+
+    // Print the scaling table.
+    std::ostringstream table;
+    table << std::fixed << std::setprecision(2) << "\n"
+          << std::setw(10) << "Threads" << std::setw(16) << "Events/s"
+          << std::setw(12) << "Speedup" << std::setw(14) << "Efficiency"
+          << std::setw(16) << "Amdahl fit";
+    for (const scaling_point& point : points) {
+        const double speedup =
+            time_per_event(reference) / time_per_event(point);
+        const double efficiency = speedup *
+                                  static_cast<double>(reference.threads) /
+                                  static_cast<double>(point.threads);
+        table << "\n"
+              << std::setw(10) << point.threads << std::setw(16)
+              << 1. / time_per_event(point) << std::setw(12) << speedup
+              << std::setw(13) << efficiency * 100. << "%";
+        if (has_fit) {
+            table << std::setw(16) << fit.throughput(point.threads);
+        }
+    }
+    TRACCC_INFO("Thread scaling:" << table.str());
+    if (has_fit) {
+        TRACCC_INFO("Amdahl fit: serial fraction = "
+                    << fit.serial_fraction << ", single-threaded throughput = "
+                    << fit.throughput(1) << " events/s, maximal speedup = "
+                    << fit.max_speedup());
+    }
+
+    // Stop here if no log file was requested.
+    if (log_file.empty()) {
+        return;
+    }
+
+    // Write the table next to the log file.
+    std::filesystem::path csv_path{log_file};
+    csv_path.replace_extension(".scaling.csv");
+    std::ofstream csv_file(csv_path);
+    if (!csv_file.good()) {
+        throw std::runtime_error("Could not open file: " + csv_path.string());
+    }
+    csv_file << "threads,events,processing_time_ns,throughput,speedup,"
+                "efficiency,amdahl_throughput\n";
+    for (const scaling_point& point : points) {
+        const double speedup =
+            time_per_event(reference) / time_per_event(point);
+        csv_file << point.threads << "," << point.events << ","
+                 << point.processing_time.count() << ","
+                 << 1. / time_per_event(point) << "," << speedup << ","
+                 << speedup * static_cast<double>(reference.threads) /
+                        static_cast<double>(point.threads)
+                 << ",";
+        if (has_fit) {
+            csv_file << fit.throughput(point.threads);
+        }
+        csv_file << "\n";
+    }
+
+    TRACCC_INFO("Wrote the thread scaling table into " << csv_path);
+}
+
+}  // namespace traccc::details
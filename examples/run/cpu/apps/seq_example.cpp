@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2025 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,6 +13,7 @@
 #include "traccc/utils/propagation.hpp"
 
 // io
+#include "traccc/io/async_writer.hpp"
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_detector.hpp"
 #include "traccc/io/read_detector_description.hpp"
@@ -21,7 +22,8 @@
 
 // algorithms
 #include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
-#include "traccc/clusterization/clusterization_algorithm.hpp"
+#include "traccc/clusterization/measurement_creation_algorithm.hpp"
+#include "traccc/clusterization/sparse_ccl_algorithm.hpp"
 #include "traccc/finding/combinatorial_kalman_filter_algorithm.hpp"
 #include "traccc/fitting/kalman_fitting_algorithm.hpp"
 #include "traccc/fitting/triplet_fitting_algorithm.hpp"
@@ -93,10 +95,16 @@ int seq_run(const traccc::opts::input_data& input_opts,
     // Construct the detector description object.
     traccc::detector_design_description::host det_descr{host_mr};
     traccc::detector_conditions_description::host det_cond{host_mr};
-    traccc::io::read_detector_description(
-        det_descr, det_cond, detector_opts.detector_file,
-        detector_opts.digitization_file, detector_opts.conditions_file,
-        traccc::data_format::json);
+    if (detector_opts.description_file.empty()) {
+        traccc::io::read_detector_description(
+            det_descr, det_cond, detector_opts.detector_file,
+            detector_opts.digitization_file, detector_opts.conditions_file,
+            traccc::data_format::json);
+    } else {
+        traccc::io::read_detector_description(
+            det_descr, det_cond, detector_opts.description_file, "", "",
+            traccc::data_format::binary);
+    }
     traccc::detector_design_description::data det_descr_data{
         vecmem::get_data(det_descr)};
     traccc::detector_conditions_description::data det_cond_data{
@@ -186,6 +194,13 @@ int seq_run(const traccc::opts::input_data& input_opts,
         traccc::fitting_performance_writer::config{},
         logger().clone("FittingPerformanceWriter"));
 
+    // Writer for the output data, running in the background.
+    traccc::io::async_writer writer{
+        traccc::io::async_writer::config{
+            .n_threads = output_opts.writer_threads,
+            .max_queued = output_opts.writer_queue_size},
+        logger().clone("AsyncWriter")};
+
     // Timers
     traccc::performance::timing_info elapsedTimes;
 
@@ -194,8 +209,7 @@ int seq_run(const traccc::opts::input_data& input_opts,
          event < input_opts.events + input_opts.skip; ++event) {
 
         traccc::edm::silicon_cell_collection::host cells_per_event{host_mr};
-        traccc::host::sparse_ccl_algorithm::output_type clusters_per_event{
-            host_mr};
+        traccc::host::sparse_ccl_algorithm::output_type clusters_per_event;
         traccc::host::measurement_creation_algorithm::output_type
             measurements_per_event{host_mr};
         spacepoint_formation_algorithm::output_type spacepoints_per_event{
@@ -231,9 +245,8 @@ int seq_run(const traccc::opts::input_data& input_opts,
                 clusters_per_event = cc(vecmem::get_data(cells_per_event),
                                         vecmem::get_data(det_cond));
                 measurements_per_event =
-                    mc(vecmem::get_data(cells_per_event),
-                       vecmem::get_data(clusters_per_event), det_descr_data,
-                       det_cond_data);
+                    mc(vecmem::get_data(cells_per_event), clusters_per_event,
+                       det_descr_data, det_cond_data);
             }
 
             // Perform seeding, track finding and fitting only when using a
@@ -249,12 +262,6 @@ int seq_run(const traccc::opts::input_data& input_opts,
                     sf(polymorphic_detector,
                        vecmem::get_data(measurements_per_event));
             }
-            if (output_opts.directory != "") {
-                traccc::io::write(event, output_opts.directory,
-                                  output_opts.format,
-                                  vecmem::get_data(spacepoints_per_event),
-                                  vecmem::get_data(measurements_per_event));
-            }
 
             /*-----------------------
               Seeding algorithm
@@ -263,11 +270,6 @@ int seq_run(const traccc::opts::input_data& input_opts,
                 traccc::performance::timer timer{"Seeding", elapsedTimes};
                 seeds = sa(vecmem::get_data(spacepoints_per_event));
             }
-            if (output_opts.directory != "") {
-                traccc::io::write(event, output_opts.directory,
-                                  output_opts.format, vecmem::get_data(seeds),
-                                  vecmem::get_data(spacepoints_per_event));
-            }
 
             /*----------------------------
               Track params estimation
@@ -288,13 +290,6 @@ int seq_run(const traccc::opts::input_data& input_opts,
                                 vecmem::get_data(measurements_per_event),
                                 vecmem::get_data(params));
             }
-            if (output_opts.directory != "") {
-                traccc::io::write(
-                    event, output_opts.directory, output_opts.format,
-                    traccc::edm::track_container<
-                        traccc::default_algebra>::const_data(track_candidates),
-                    polymorphic_detector);
-            }
 
             {
                 // Perform ambiguity resolution only if asked for.
@@ -364,6 +359,41 @@ int seq_run(const traccc::opts::input_data& input_opts,
                     });
             }
         }
+
+        /*------------
+             Output
+          ------------*/
+
+        // Hand the event's results over to the background writer(s). The
+        // track candidates refer to the measurements, which (being moved
+        // along with them) stay at the same memory location.
+        if (output_opts.directory != "") {
+            writer.submit([event, &output_opts, &polymorphic_detector,
+                           measurements = std::move(measurements_per_event),
+                           spacepoints = std::move(spacepoints_per_event),
+                           event_seeds = std::move(seeds),
+                           tracks = std::move(track_candidates)]() {
+                traccc::io::write(event, output_opts.directory,
+                                  output_opts.format,
+                                  vecmem::get_data(spacepoints),
+                                  vecmem::get_data(measurements));
+                traccc::io::write(event, output_opts.directory,
+                                  output_opts.format,
+                                  vecmem::get_data(event_seeds),
+                                  vecmem::get_data(spacepoints));
+                traccc::io::write(
+                    event, output_opts.directory, output_opts.format,
+                    traccc::edm::track_container<
+                        traccc::default_algebra>::const_data(tracks),
+                    polymorphic_detector);
+            });
+        }
+    }
+
+    // Wait for all output to be written.
+    {
+        traccc::performance::timer timer{"Output flush", elapsedTimes};
+        writer.flush();
     }
 
     if (performance_opts.run) {
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2025 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/ambiguity_resolution/greedy_ambiguity_resolution_algorithm.hpp"
 #include "traccc/bfield/magnetic_field.hpp"
 #include "traccc/clusterization/clusterization_algorithm.hpp"
 #include "traccc/edm/silicon_cell_collection.hpp"
@@ -19,6 +20,7 @@
 #include "traccc/geometry/detector.hpp"
 #include "traccc/geometry/detector_design_description.hpp"
 #include "traccc/geometry/host_detector.hpp"
+#include "traccc/performance/timing_info.hpp"
 #include "traccc/seeding/seeding_algorithm.hpp"
 #include "traccc/seeding/silicon_pixel_spacepoint_formation_algorithm.hpp"
 #include "traccc/seeding/track_params_estimation.hpp"
@@ -33,6 +35,7 @@
 #include <vecmem/utils/copy.hpp>
 
 // System include(s).
+#include <cstddef>
 #include <functional>
 #include <memory>
 
@@ -42,6 +45,10 @@ namespace traccc {
 ///
 /// At least as much as is implemented in the project at any given moment.
 ///
+/// Single events can optionally be processed with multiple threads. Though
+/// only the clusterization and the track fitting are parallelised this way.
+/// See @c set_intra_event_parallelism.
+///
 class full_chain_algorithm
     : public algorithm<edm::track_collection<default_algebra>::host(
           const edm::silicon_cell_collection::host&)>,
@@ -61,6 +68,23 @@ class full_chain_algorithm
         traccc::host::combinatorial_kalman_filter_algorithm;
     /// Track fitting algorithm type
     using fitting_algorithm = traccc::host::kalman_fitting_algorithm;
+    /// Ambiguity resolution algorithm type
+    using ambiguity_resolution_algorithm =
+        traccc::host::greedy_ambiguity_resolution_algorithm;
+
+    /// Intermediate results of an event
+    ///
+    /// Used as the (cached) input for benchmarking the later reconstruction
+    /// stages in isolation.
+    ///
+    struct stage_inputs {
+        /// The measurements of the event
+        clustering_algorithm::output_type measurements;
+        /// The seed track parameters of the event
+        bound_track_parameters_collection_types::host track_params;
+        /// The track candidates of the event
+        finding_algorithm::output_type track_candidates;
+    };
 
     /// @}
 
@@ -95,6 +119,16 @@ class full_chain_algorithm
     output_type operator()(
         const edm::silicon_cell_collection::host& cells) const override;
 
+    /// Reconstruct track parameters in the entire detector
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param stage_times Timing information to record the time spent in
+    ///                    the individual reconstruction stages into
+    /// @return The track parameters reconstructed
+    ///
+    output_type operator()(const edm::silicon_cell_collection::host& cells,
+                           performance::timing_info& stage_times) const;
+
     /// Reconstruct track seeds in the entire detector
     ///
     /// @param cells The cells for every detector module in the event
@@ -103,7 +137,147 @@ class full_chain_algorithm
     bound_track_parameters_collection_types::host seeding(
         const edm::silicon_cell_collection::host& cells) const;
 
+    /// Reconstruct track seeds in the entire detector
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param stage_times Timing information to record the time spent in
+    ///                    the individual reconstruction stages into
+    /// @return The track seeds reconstructed
+    ///
+    bound_track_parameters_collection_types::host seeding(
+        const edm::silicon_cell_collection::host& cells,
+        performance::timing_info& stage_times) const;
+
+    /// @name Functions benchmarking individual reconstruction stages
+    /// @{
+
+    /// Run the reconstruction up to, and including, the clusterization
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param stage_times Timing information for the reconstruction stages
+    /// @return The number of reconstructed measurements
+    ///
+    std::size_t run_clusterization(
+        const edm::silicon_cell_collection::host& cells,
+        performance::timing_info& stage_times) const;
+
+    /// Run the reconstruction up to, and including, the spacepoint formation
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param stage_times Timing information for the reconstruction stages
+    /// @return The number of reconstructed spacepoints
+    ///
+    std::size_t run_spacepoint_formation(
+        const edm::silicon_cell_collection::host& cells,
+        performance::timing_info& stage_times) const;
+
+    /// Prepare the inputs of the later reconstruction stages for an event
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @return The intermediate results of the event
+    ///
+    stage_inputs prepare_stage_inputs(
+        const edm::silicon_cell_collection::host& cells) const;
+
+    /// Run only the track finding, starting from the event's seeds
+    ///
+    /// @param inputs The intermediate results of the event
+    /// @param stage_times Timing information for the reconstruction stages
+    /// @return The number of track candidates found
+    ///
+    std::size_t run_track_finding(const stage_inputs& inputs,
+                                  performance::timing_info& stage_times) const;
+
+    /// Run only the track fitting, on the event's track candidates
+    ///
+    /// @param inputs The intermediate results of the event
+    /// @param stage_times Timing information for the reconstruction stages
+    /// @return The number of fitted tracks
+    ///
+    std::size_t run_track_fitting(const stage_inputs& inputs,
+                                  performance::timing_info& stage_times) const;
+
+    /// Run only the ambiguity resolution, on the event's track candidates
+    ///
+    /// @param inputs The intermediate results of the event
+    /// @param stage_times Timing information for the reconstruction stages
+    /// @return The number of tracks surviving the ambiguity resolution
+    ///
+    std::size_t run_ambiguity_resolution(
+        const stage_inputs& inputs,
+        performance::timing_info& stage_times) const;
+
+    /// @}
+
+    /// Enable/disable the parallel reconstruction of individual events
+    ///
+    /// When enabled, the algorithm splits the work of single events into
+    /// tasks executed in the calling thread's TBB task arena. So it can make
+    /// use of the threads of an arena that is also processing multiple events
+    /// at the same time.
+    ///
+    /// Only two stages are split up:
+    ///  - the clusterization, in chunks of whole detector modules;
+    ///  - the track fitting, in chunks of track candidates.
+    ///
+    /// Spacepoint formation, seeding, track parameter estimation, track
+    /// finding and ambiguity resolution always process the whole event in the
+    /// calling thread. The results do not depend on the number of threads.
+    ///
+    /// @param value Whether to use intra-event parallelism
+    ///
+    void set_intra_event_parallelism(bool value);
+
     private:
+    /// Reconstruct track seeds, keeping the reconstructed measurements
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @param measurements The measurements reconstructed from the cells
+    /// @param stage_times Timing information for the reconstruction stages
+    /// @return The track seeds reconstructed
+    ///
+    bound_track_parameters_collection_types::host seeding(
+        const edm::silicon_cell_collection::host& cells,
+        clustering_algorithm::output_type& measurements,
+        performance::timing_info& stage_times) const;
+
+    /// Run the spacepoint formation on the measurements of an event
+    ///
+    /// @param measurements The measurements of the event
+    /// @param stage_times Timing information for the reconstruction stages
+    /// @return The spacepoints of the event
+    ///
+    spacepoint_formation_algorithm::output_type form_spacepoints(
+        const edm::measurement_collection::const_view& measurements,
+        performance::timing_info& stage_times) const;
+
+    /// Run the clusterization on the cells of an event
+    ///
+    /// @param cells The cells for every detector module in the event
+    /// @return The measurements of the event
+    ///
+    clustering_algorithm::output_type clusterize(
+        const edm::silicon_cell_collection::host& cells) const;
+
+    /// Run the track finding on an event
+    ///
+    /// @param measurements The measurements of the event
+    /// @param track_params The seed track parameters of the event
+    /// @return The track candidates of the event
+    ///
+    finding_algorithm::output_type find_tracks(
+        const edm::measurement_collection::const_view& measurements,
+        const bound_track_parameters_collection_types::host& track_params)
+        const;
+
+    /// Run the track fitting on an event
+    ///
+    /// @param track_candidates The track candidates of the event
+    /// @return The fitted tracks of the event
+    ///
+    fitting_algorithm::output_type fit_tracks(
+        const finding_algorithm::output_type& track_candidates) const;
+
     /// Memory resource
     std::reference_wrapper<vecmem::memory_resource> m_mr;
     /// Vecmem copy object
@@ -136,6 +310,8 @@ class full_chain_algorithm
     finding_algorithm m_finding;
     /// Track fitting algorithm
     fitting_algorithm m_fitting;
+    /// Ambiguity resolution algorithm
+    ambiguity_resolution_algorithm m_ambiguity_resolution;
 
     /// @}
 
@@ -161,6 +337,9 @@ class full_chain_algorithm
     const bool usingGBTS;
 
     /// @}
+
+    /// Flag for splitting the work of single events into multiple tasks
+    bool m_intra_event_parallelism = false;
 };  // class full_chain_algorithm
 
 }  // namespace traccc
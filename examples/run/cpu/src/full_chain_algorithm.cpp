@@ -8,6 +8,50 @@
 // Local include(s).
 #include "traccc/examples/cpu/full_chain_algorithm.hpp"
 
+// Project include(s).
+#include "traccc/performance/timer.hpp"
+
+// TBB include(s).
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+// System include(s).
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+/// Append the contents of one track container to another one
+///
+/// @param target The container to append to
+/// @param source The container to append
+///
+void append_tracks(
+    traccc::edm::track_container<traccc::default_algebra>::host& target,
+    const traccc::edm::track_container<traccc::default_algebra>::host&
+        source) {
+
+    const auto state_offset = static_cast<unsigned int>(target.states.size());
+    for (std::size_t i = 0; i < source.states.size(); ++i) {
+        target.states.push_back(source.states.at(i));
+    }
+    for (std::size_t i = 0; i < source.tracks.size(); ++i) {
+        target.tracks.push_back(source.tracks.at(i));
+        for (traccc::edm::track_constituent_link& link :
+             target.tracks.constituent_links().back()) {
+            if (link.type ==
+                traccc::edm::track_constituent_link::track_state) {
+                link.index += state_offset;
+            }
+        }
+    }
+}
+
+}  // namespace
+
 namespace traccc {
 
 full_chain_algorithm::full_chain_algorithm(
@@ -40,6 +84,8 @@ full_chain_algorithm::full_chain_algorithm(
       m_finding(finding_config, mr, logger->cloneWithSuffix("TrackFindingAlg")),
       m_fitting(fitting_config, mr, *m_copy,
                 logger->cloneWithSuffix("TrackFittingAlg")),
+      m_ambiguity_resolution(ambiguity_resolution_algorithm::config_type{}, mr,
+                             logger->cloneWithSuffix("AmbiguityResolutionAlg")),
       m_finder_config(finder_config),
       m_grid_config(grid_config),
       m_filter_config(filter_config),
@@ -59,45 +105,34 @@ full_chain_algorithm::full_chain_algorithm(
 full_chain_algorithm::output_type full_chain_algorithm::operator()(
     const edm::silicon_cell_collection::host& cells) const {
 
-    // Create a data object for the detector description.
-    const detector_design_description::const_data det_descr_data =
-        vecmem::get_data(m_det_descr.get());
-    const detector_conditions_description::const_data det_cond_data =
-        vecmem::get_data(m_det_cond.get());
-    // Run the clusterization.
-    auto cells_data = vecmem::get_data(cells);
-    const clustering_algorithm::output_type measurements =
-        m_clusterization(cells_data, det_descr_data, det_cond_data);
+    performance::timing_info stage_times;
+    return (*this)(cells, stage_times);
+}
+
+full_chain_algorithm::output_type full_chain_algorithm::operator()(
+    const edm::silicon_cell_collection::host& cells,
+    performance::timing_info& stage_times) const {
+
+    // Run the seeding.
+    clustering_algorithm::output_type measurements{m_mr.get()};
+    const host::track_params_estimation::output_type track_params =
+        seeding(cells, measurements, stage_times);
 
-    // If we have a Detray detector, run the seeding track finding and fitting.
+    // If we have a Detray detector, run the track finding and fitting.
     if (m_detector != nullptr) {
 
-        // Run the seed-finding.
+        // Run the track finding.
         const edm::measurement_collection::const_data measurements_view =
             vecmem::get_data(measurements);
-        const spacepoint_formation_algorithm::output_type spacepoints =
-            m_spacepoint_formation(*m_detector, measurements_view);
-        const edm::spacepoint_collection::const_data spacepoints_data =
-            vecmem::get_data(spacepoints);
-        const host::seeding_algorithm::output_type seeds =
-            m_seeding(spacepoints_data);
-        const edm::seed_collection::const_data seeds_data =
-            vecmem::get_data(seeds);
-        const host::track_params_estimation::output_type track_params =
-            m_track_parameter_estimation(measurements_view, spacepoints_data,
-                                         seeds_data, m_field_vec);
-        const bound_track_parameters_collection_types::const_view
-            track_params_view = vecmem::get_data(track_params);
-
-        // Run the track finding.
-        const finding_algorithm::output_type track_candidates = m_finding(
-            *m_detector, m_field, measurements_view, track_params_view);
+        finding_algorithm::output_type track_candidates{m_mr.get()};
+        {
+            performance::timer t{"Track finding", stage_times};
+            track_candidates = find_tracks(measurements_view, track_params);
+        }
 
         // Run the track fitting, and return its results.
-        return m_fitting(*m_detector, m_field,
-                         edm::track_container<default_algebra>::const_data(
-                             track_candidates))
-            .tracks;
+        performance::timer t{"Track fitting", stage_times};
+        return fit_tracks(track_candidates).tracks;
     }
     // If not, just return an empty object.
     else {
@@ -110,30 +145,57 @@ full_chain_algorithm::output_type full_chain_algorithm::operator()(
 bound_track_parameters_collection_types::host full_chain_algorithm::seeding(
     const edm::silicon_cell_collection::host& cells) const {
 
-    // Create a data object for the detector description.
-    const detector_design_description::const_data det_descr_data =
-        vecmem::get_data(m_det_descr.get());
-    const detector_conditions_description::const_data det_cond_data =
-        vecmem::get_data(m_det_cond.get());
+    performance::timing_info stage_times;
+    return seeding(cells, stage_times);
+}
+
+bound_track_parameters_collection_types::host full_chain_algorithm::seeding(
+    const edm::silicon_cell_collection::host& cells,
+    performance::timing_info& stage_times) const {
+
+    clustering_algorithm::output_type measurements{m_mr.get()};
+    return seeding(cells, measurements, stage_times);
+}
+
+void full_chain_algorithm::set_intra_event_parallelism(bool value) {
+
+    m_intra_event_parallelism = value;
+    m_clusterization.set_intra_event_parallelism(value);
+}
+
+bound_track_parameters_collection_types::host full_chain_algorithm::seeding(
+    const edm::silicon_cell_collection::host& cells,
+    clustering_algorithm::output_type& measurements,
+    performance::timing_info& stage_times) const {
+
     // Run the clusterization.
-    auto cells_data = vecmem::get_data(cells);
-    const clustering_algorithm::output_type measurements =
-        m_clusterization(cells_data, det_descr_data, det_cond_data);
+    {
+        performance::timer t{"Clusterization", stage_times};
+        measurements = clusterize(cells);
+    }
 
-    // If we have a Detray detector, run the seeding track finding and fitting.
+    // If we have a Detray detector, run the seeding.
     if (m_detector != nullptr) {
 
-        // Run the seed-finding.
+        // Run the spacepoint formation.
         const edm::measurement_collection::const_data measurements_view =
             vecmem::get_data(measurements);
         const spacepoint_formation_algorithm::output_type spacepoints =
-            m_spacepoint_formation(*m_detector, measurements_view);
+            form_spacepoints(measurements_view, stage_times);
         const edm::spacepoint_collection::const_data spacepoints_data =
             vecmem::get_data(spacepoints);
-        const host::seeding_algorithm::output_type seeds =
-            m_seeding(spacepoints_data);
+
+        // Run the seed-finding.
+        host::seeding_algorithm::output_type seeds{m_mr.get()};
+        {
+            performance::timer t{"Seeding", stage_times};
+            seeds = m_seeding(spacepoints_data);
+        }
         const edm::seed_collection::const_data seeds_data =
             vecmem::get_data(seeds);
+
+        // Run the track parameter estimation.
+        performance::timer t{"Track params estimation", stage_times};
         return m_track_parameter_estimation(measurements_view, spacepoints_data,
                                             seeds_data, m_field_vec);
     }
@@ -145,4 +207,193 @@ bound_track_parameters_collection_types::host full_chain_algorithm::seeding(
     }
 }
 
+std::size_t full_chain_algorithm::run_clusterization(
+    const edm::silicon_cell_collection::host& cells,
+    performance::timing_info& stage_times) const {
+
+    performance::timer t{"Clusterization", stage_times};
+    return clusterize(cells).size();
+}
+
+std::size_t full_chain_algorithm::run_spacepoint_formation(
+    const edm::silicon_cell_collection::host& cells,
+    performance::timing_info& stage_times) const {
+
+    // Run the clusterization.
+    clustering_algorithm::output_type measurements{m_mr.get()};
+    {
+        performance::timer t{"Clusterization", stage_times};
+        measurements = clusterize(cells);
+    }
+
+    // If we have a Detray detector, run the spacepoint formation.
+    if (m_detector != nullptr) {
+        const edm::measurement_collection::const_data measurements_view =
+            vecmem::get_data(measurements);
+        return form_spacepoints(measurements_view, stage_times).size();
+    }
+    // If not, there are no spacepoints.
+    else {
+        return 0u;
+    }
+}
+
+full_chain_algorithm::stage_inputs full_chain_algorithm::prepare_stage_inputs(
+    const edm::silicon_cell_collection::host& cells) const {
+
+    stage_inputs result{clustering_algorithm::output_type{m_mr.get()},
+                        bound_track_parameters_collection_types::host{},
+                        finding_algorithm::output_type{m_mr.get()}};
+
+    // Run the reconstruction up to the track finding.
+    performance::timing_info stage_times;
+    result.track_params = seeding(cells, result.measurements, stage_times);
+    if (m_detector != nullptr) {
+        const edm::measurement_collection::const_data measurements_view =
+            vecmem::get_data(result.measurements);
+        result.track_candidates =
+            find_tracks(measurements_view, result.track_params);
+    }
+    return result;
+}
+
+std::size_t full_chain_algorithm::run_track_finding(
+    const stage_inputs& inputs, performance::timing_info& stage_times) const {
+
+    // Without a Detray detector there are no track candidates.
+    if (m_detector == nullptr) {
+        return 0u;
+    }
+
+    const edm::measurement_collection::const_data measurements_view =
+        vecmem::get_data(inputs.measurements);
+    performance::timer t{"Track finding", stage_times};
+    return find_tracks(measurements_view, inputs.track_params).tracks.size();
+}
+
+std::size_t full_chain_algorithm::run_track_fitting(
+    const stage_inputs& inputs, performance::timing_info& stage_times) const {
+
+    // Without a Detray detector there are no tracks to fit.
+    if (m_detector == nullptr) {
+        return 0u;
+    }
+
+    performance::timer t{"Track fitting", stage_times};
+    return fit_tracks(inputs.track_candidates).tracks.size();
+}
+
+std::size_t full_chain_algorithm::run_ambiguity_resolution(
+    const stage_inputs& inputs, performance::timing_info& stage_times) const {
+
+    performance::timer t{"Track ambiguity resolution", stage_times};
+    return m_ambiguity_resolution(
+               edm::track_container<default_algebra>::const_data(
+                   inputs.track_candidates))
+        .tracks.size();
+}
+
+full_chain_algorithm::spacepoint_formation_algorithm::output_type
+full_chain_algorithm::form_spacepoints(
+    const edm::measurement_collection::const_view& measurements,
+    performance::timing_info& stage_times) const {
+
+    assert(m_detector != nullptr);
+    performance::timer t{"Spacepoint formation", stage_times};
+    return m_spacepoint_formation(*m_detector, measurements);
+}
+
+full_chain_algorithm::clustering_algorithm::output_type
+full_chain_algorithm::clusterize(
+    const edm::silicon_cell_collection::host& cells) const {
+
+    // Create data objects for the inputs. With intra-event parallelism
+    // enabled, the clusterization algorithm splits up large events by itself.
+    const edm::silicon_cell_collection::const_data cells_data =
+        vecmem::get_data(cells);
+    const detector_design_description::const_data det_descr_data =
+        vecmem::get_data(m_det_descr.get());
+    const detector_conditions_description::const_data det_cond_data =
+        vecmem::get_data(m_det_cond.get());
+
+    // Run the clusterization on all cells in one go.
+    return m_clusterization(cells_data, det_descr_data, det_cond_data);
+}
+
+full_chain_algorithm::finding_algorithm::output_type
+full_chain_algorithm::find_tracks(
+    const edm::measurement_collection::const_view& measurements,
+    const bound_track_parameters_collection_types::host& track_params) const {
+
+    assert(m_detector != nullptr);
+
+    // Process all seeds in one go, even with intra-event parallelism. The
+    // duplicate removal and the per-measurement track limit of the track
+    // finding need to see all track candidates of the event, so splitting the
+    // seeds would make the results depend on the number of threads.
+    return m_finding(*m_detector, m_field, measurements,
+                     vecmem::get_data(track_params));
+}
+
+full_chain_algorithm::fitting_algorithm::output_type
+full_chain_algorithm::fit_tracks(
+    const finding_algorithm::output_type& track_candidates) const {
+
+    assert(m_detector != nullptr);
+
+    // Decide how many chunks to split the track candidates into.
+    const std::size_t n_tracks = track_candidates.tracks.size();
+    const std::size_t n_chunks =
+        (m_intra_event_parallelism
+             ? std::min(n_tracks, static_cast<std::size_t>(
+                                      tbb::this_task_arena::max_concurrency()))
+             : 1u);
+
+    // In the simplest case, fit all track candidates in one go.
+    if (n_chunks <= 1u) {
+        return m_fitting(*m_detector, m_field,
+                         edm::track_container<default_algebra>::const_data(
+                             track_candidates));
+    }
+
+    // Fit chunks of track candidates separately.
+    std::vector<fitting_algorithm::output_type> chunk_tracks;
+    chunk_tracks.reserve(n_chunks);
+    for (std::size_t i = 0; i < n_chunks; ++i) {
+        chunk_tracks.emplace_back(m_mr.get(), track_candidates.measurements);
+    }
+    const std::size_t chunk_size = (n_tracks + n_chunks - 1) / n_chunks;
+    tbb::this_task_arena::isolate([&]() {
+        tbb::parallel_for(
+            tbb::blocked_range<std::size_t>{0u, n_chunks, 1u},
+            [&](const tbb::blocked_range<std::size_t>& range) {
+                for (std::size_t i = range.begin(); i != range.end(); ++i) {
+                    const std::size_t begin =
+                        std::min(i * chunk_size, n_tracks);
+                    const std::size_t end =
+                        std::min(begin + chunk_size, n_tracks);
+                    finding_algorithm::output_type chunk_candidates{
+                        m_mr.get(), track_candidates.measurements};
+                    chunk_candidates.tracks.reserve(end - begin);
+                    for (std::size_t j = begin; j < end; ++j) {
+                        chunk_candidates.tracks.push_back(
+                            track_candidates.tracks.at(j));
+                    }
+                    chunk_tracks[i] = m_fitting(
+                        *m_detector, m_field,
+                        edm::track_container<default_algebra>::const_data(
+                            chunk_candidates));
+                }
+            });
+    });
+
+    // Merge the results.
+    fitting_algorithm::output_type result{m_mr.get(),
+                                          track_candidates.measurements};
+    for (const fitting_algorithm::output_type& chunk : chunk_tracks) {
+        append_tracks(result, chunk);
+    }
+    return result;
+}
+
 }  // namespace traccc
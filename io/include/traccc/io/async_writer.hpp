@@ -0,0 +1,218 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/data_format.hpp"
+#include "traccc/io/write.hpp"
+
+// Project include(s).
+#include "traccc/edm/track_container.hpp"
+#include "traccc/utils/logging.hpp"
+#include "traccc/utils/messaging.hpp"
+
+// System include(s).
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace traccc::io {
+
+namespace details {
+
+/// Helper trait for recognising @c std::reference_wrapper arguments
+template <typename T>
+struct is_reference_wrapper : std::false_type {};
+template <typename T>
+struct is_reference_wrapper<std::reference_wrapper<T>> : std::true_type {};
+
+/// Turn an argument owned by an asynchronous write into what
+/// @c traccc::io::write expects
+///
+/// - Host collections are turned into (constant) views with
+///   @c vecmem::get_data;
+/// - Host track containers are turned into their constant data type;
+/// - Reference wrappers are unwrapped;
+/// - Anything else is passed on as-is.
+///
+template <typename T>
+decltype(auto) async_write_argument(const T& arg) {
+
+    if constexpr (is_reference_wrapper<T>::value) {
+        return arg.get();
+    } else if constexpr (std::is_same_v<
+                             T, edm::track_container<default_algebra>::host>) {
+        return edm::track_container<default_algebra>::const_data{arg};
+    } else if constexpr (requires { vecmem::get_data(arg); }) {
+        return vecmem::get_data(arg);
+    } else {
+        return arg;
+    }
+}
+
+}  // namespace details
+
+/// Service writing event data to disk from background threads
+///
+/// Writes are submitted as tasks into a bounded queue, from which a fixed
+/// number of background threads pick them up. The tasks take ownership of
+/// the data that they write, so the submitting thread is free to carry on
+/// with the next event straight away. When the queue is full, submitting a
+/// new task blocks until a background thread frees up a slot, which limits
+/// the amount of event data held in memory for writing.
+///
+/// The first exception thrown by any of the tasks is re-thrown by the next
+/// call to @c submit(...), @c write(...) or @c flush(). All submitted tasks
+/// are guaranteed to be executed before the object is destroyed.
+///
+/// Note that all memory resources used by the submitted data, and all data
+/// that it references (for instance the measurements referenced by a track
+/// container), must stay valid until @c flush() returns.
+///
+class async_writer : public messaging {
+
+    public:
+    /// Configuration for the writer
+    struct config {
+        /// The number of background threads to write the data with
+        ///
+        /// With zero threads every task is executed synchronously, by the
+        /// thread submitting it, with any exception propagating straight to
+        /// the caller.
+        ///
+        std::size_t n_threads = 1;
+        /// The maximum number of tasks waiting in the queue
+        std::size_t max_queued = 4;
+    };
+
+    /// Constructor with a configuration
+    ///
+    /// @param cfg     The configuration for the writer
+    /// @param ilogger The logger to use for messages
+    ///
+    explicit async_writer(
+        const config& cfg,
+        std::unique_ptr<const Logger> ilogger = getDummyLogger().clone());
+    /// Destructor, waiting for all submitted tasks to finish
+    ~async_writer();
+
+    /// Disallow copying the writer
+    async_writer(const async_writer&) = delete;
+    /// Disallow moving the writer
+    async_writer(async_writer&&) = delete;
+    /// Disallow copy-assigning the writer
+    async_writer& operator=(const async_writer&) = delete;
+    /// Disallow move-assigning the writer
+    async_writer& operator=(async_writer&&) = delete;
+
+    /// Submit an arbitrary task for execution
+    ///
+    /// The task is moved into the writer, so it may own the data that it
+    /// needs to write.
+    ///
+    /// @param task_functor The (possibly move-only) functor to execute
+    ///
+    template <typename FUNCTOR>
+    void submit(FUNCTOR&& task_functor);
+
+    /// Write some event data asynchronously
+    ///
+    /// The arguments are moved (or copied) into the task, and then handed to
+    /// the appropriate @c traccc::io::write overload once the task is
+    /// executed. Host collections are passed to @c traccc::io::write as
+    /// views, and objects that need to be passed by reference (like the
+    /// detector for writing tracks) can be passed with @c std::cref.
+    ///
+    /// @param event     The event index
+    /// @param directory The directory to write the file(s) into
+    /// @param format    The data format to write the event data in
+    /// @param args      The event data (and detector) to write
+    ///
+    template <typename... ARGS>
+    void write(std::size_t event, std::string_view directory,
+               data_format format, ARGS&&... args);
+
+    /// Wait for all submitted tasks to finish
+    ///
+    /// @throw Any exception thrown by one of the tasks since the last check
+    ///
+    void flush();
+
+    /// Get the number of tasks that are queued or being executed
+    std::size_t pending() const;
+
+    private:
+    /// Base class for the type-erased tasks
+    struct task_base {
+        /// Virtual destructor
+        virtual ~task_base() = default;
+        /// Execute the task
+        virtual void execute() = 0;
+    };
+    /// Type-erased (move-only) task
+    template <typename FUNCTOR>
+    struct task : public task_base {
+        /// Constructor from a functor
+        template <typename F>
+        explicit task(F&& f) : m_functor(std::forward<F>(f)) {}
+        /// Execute the functor
+        void execute() override { m_functor(); }
+        /// The functor to execute
+        FUNCTOR m_functor;
+    };
+
+    /// Put a task into the queue, waiting for a free slot if necessary
+    void enqueue(std::unique_ptr<task_base> t);
+    /// Function executed by the background threads
+    void process();
+    /// Let the background threads finish the queued tasks, and join them
+    void stop();
+    /// Re-throw the first error recorded by the tasks, if there was one
+    void rethrow();
+
+    /// The configuration of the writer
+    config m_config;
+
+    /// Mutex protecting the state of the queue
+    mutable std::mutex m_mutex;
+    /// Condition signalling that a task was added, or a stop was requested
+    std::condition_variable m_task_added;
+    /// Condition signalling that a task was taken from the queue
+    std::condition_variable m_slot_freed;
+    /// Condition signalling that a task was finished
+    std::condition_variable m_task_done;
+
+    /// Tasks waiting to be executed
+    std::deque<std::unique_ptr<task_base>> m_queue;
+    /// Number of tasks queued or being executed
+    std::size_t m_pending = 0;
+    /// Flag telling the background threads to stop once the queue is empty
+    bool m_stop = false;
+    /// The first error thrown by any of the tasks
+    std::exception_ptr m_error;
+
+    /// The background threads
+    std::vector<std::thread> m_threads;
+
+};  // class async_writer
+
+}  // namespace traccc::io
+
+// Include the implementation.
+#include "traccc/io/impl/async_writer.ipp"
@@ -0,0 +1,238 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace traccc::io::csv {
+namespace details {
+
+/// Parse a single numeric value from a CSV field
+///
+/// Surrounding spaces and a leading '+' sign are accepted, empty fields
+/// result in a value-initialised value.
+///
+template <typename TYPE>
+bool parse_csv_value(std::string_view field, TYPE& value) {
+
+    // Trim the field.
+    while (!field.empty() && (field.front() == ' ')) {
+        field.remove_prefix(1);
+    }
+    while (!field.empty() && (field.back() == ' ')) {
+        field.remove_suffix(1);
+    }
+    if (field.empty()) {
+        value = TYPE{};
+        return true;
+    }
+    if (field.front() == '+') {
+        field.remove_prefix(1);
+    }
+
+    // Single byte types were historically read as characters (by
+    // std::istream), and written that way by our simulation. So accept a
+    // single non-digit character for them as a raw value.
+    if constexpr (sizeof(TYPE) == 1u) {
+        if ((field.size() == 1u) && ((field.front() < '0') ||
+                                     (field.front() > '9'))) {
+            value = static_cast<TYPE>(field.front());
+            return true;
+        }
+    }
+
+    // Parse the value.
+    const auto [end, error] =
+        std::from_chars(field.data(), field.data() + field.size(), value);
+    return (error == std::errc{}) && (end == field.data() + field.size());
+}
+
+}  // namespace details
+
+template <typename RECORD>
+record_reader<RECORD>::record_reader(
+    std::string_view filename, const std::vector<std::string>& optional_columns)
+    : m_filename(filename), m_file(filename) {
+
+    m_remaining = {reinterpret_cast<const char*>(m_file.data()),
+                   m_file.size()};
+
+    // Read the header of the file.
+    std::string_view header;
+    if (!next_line(m_remaining, header)) {
+        throw std::runtime_error("Could not read header from '" + m_filename +
+                                 "'");
+    }
+    ++m_line_number;
+    while (true) {
+        const std::size_t comma = header.find(',');
+        m_columns.emplace_back(header.substr(0, comma));
+        if (comma == std::string_view::npos) {
+            break;
+        }
+        header.remove_prefix(comma + 1);
+    }
+
+    // Set up the parsers of all the fields of the record.
+    const auto names = RECORD::names();
+    const std::array<parser_type, N_FIELDS> parsers =
+        []<std::size_t... INDICES>(std::index_sequence<INDICES...>) {
+            return std::array<parser_type, N_FIELDS>{
+                {[](std::string_view field, RECORD& record) {
+                    return details::parse_csv_value(
+                        field, record.template get<INDICES>());
+                }...}};
+        }(std::make_index_sequence<N_FIELDS>{});
+
+    // Assign them to the columns of the file.
+    m_parsers.resize(m_columns.size(), nullptr);
+    for (std::size_t i = 0; i < N_FIELDS; ++i) {
+        const auto column =
+            std::find(m_columns.begin(), m_columns.end(), names[i]);
+        if (column != m_columns.end()) {
+            m_parsers[static_cast<std::size_t>(column - m_columns.begin())] =
+                parsers[i];
+        } else if (std::find(optional_columns.begin(), optional_columns.end(),
+                             names[i]) == optional_columns.end()) {
+            throw std::runtime_error("Missing header column '" + names[i] +
+                                     "' in '" + m_filename + "'");
+        }
+    }
+}
+
+template <typename RECORD>
+bool record_reader<RECORD>::read(RECORD& record) {
+
+    // Get the next non-empty line.
+    std::string_view line;
+    do {
+        if (!next_line(m_remaining, line)) {
+            return false;
+        }
+        ++m_line_number;
+    } while (line.empty());
+
+    // Parse it.
+    parse(line, record, m_line_number);
+    return true;
+}
+
+template <typename RECORD>
+std::vector<std::string_view> record_reader<RECORD>::split(
+    std::size_t max_chunks, std::size_t min_chunk_size) const {
+
+    // Decide about the size of the chunks.
+    const std::size_t n_chunks = std::clamp<std::size_t>(
+        m_remaining.size() / std::max<std::size_t>(min_chunk_size, 1u), 1u,
+        std::max<std::size_t>(max_chunks, 1u));
+    const std::size_t chunk_size = m_remaining.size() / n_chunks;
+
+    // Split the remaining text at the first line ending after each chunk
+    // boundary.
+    std::vector<std::string_view> result;
+    result.reserve(n_chunks);
+    std::string_view text = m_remaining;
+    while (!text.empty()) {
+        if (result.size() + 1 == n_chunks) {
+            result.push_back(text);
+            break;
+        }
+        const std::size_t newline = text.find('\n', chunk_size);
+        const std::size_t length = (newline == std::string_view::npos
+                                        ? text.size()
+                                        : newline + 1);
+        result.push_back(text.substr(0, length));
+        text.remove_prefix(length);
+    }
+    return result;
+}
+
+template <typename RECORD>
+bool record_reader<RECORD>::read(std::string_view& chunk,
+                                 RECORD& record) const {
+
+    // Get the next non-empty line.
+    std::string_view line;
+    do {
+        if (!next_line(chunk, line)) {
+            return false;
+        }
+    } while (line.empty());
+
+    // Parse it.
+    parse(line, record, 0u);
+    return true;
+}
+
+template <typename RECORD>
+bool record_reader<RECORD>::next_line(std::string_view& text,
+                                      std::string_view& line) {
+
+    if (text.empty()) {
+        return false;
+    }
+
+    // Find the end of the line.
+    const void* newline = std::memchr(text.data(), '\n', text.size());
+    const std::size_t length =
+        (newline == nullptr
+             ? text.size()
+             : static_cast<std::size_t>(static_cast<const char*>(newline) -
+                                        text.data()));
+    line = text.substr(0, length);
+    text.remove_prefix(std::min(length + 1, text.size()));
+
+    // Remove Windows line endings.
+    if (!line.empty() && (line.back() == '\r')) {
+        line.remove_suffix(1);
+    }
+    return true;
+}
+
+template <typename RECORD>
+void record_reader<RECORD>::parse(std::string_view line, RECORD& record,
+                                  std::size_t line_number) const {
+
+    // Description of the line, for error messages.
+    auto location = [&]() {
+        return (line_number > 0 ? "line " + std::to_string(line_number)
+                                : std::string{"a line"}) +
+               " of '" + m_filename + "'";
+    };
+
+    // Parse all columns of the line.
+    for (std::size_t i = 0; i < m_parsers.size(); ++i) {
+        const char* comma = static_cast<const char*>(
+            std::memchr(line.data(), ',', line.size()));
+        const bool last_column = (i + 1 == m_parsers.size());
+        if ((comma == nullptr) && !last_column) {
+            throw std::runtime_error("Too few columns in " + location());
+        }
+        if ((comma != nullptr) && last_column) {
+            throw std::runtime_error("Too many columns in " + location());
+        }
+        const std::size_t length =
+            (comma == nullptr ? line.size()
+                              : static_cast<std::size_t>(comma - line.data()));
+        if ((m_parsers[i] != nullptr) &&
+            !m_parsers[i](line.substr(0, length), record)) {
+            throw std::runtime_error("Could not parse column '" +
+                                     m_columns[i] + "' in " + location());
+        }
+        line.remove_prefix(std::min(length + 1, line.size()));
+    }
+}
+
+}  // namespace traccc::io::csv
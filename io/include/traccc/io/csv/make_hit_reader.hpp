@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,8 +8,8 @@
 #pragma once
 
 // Local include(s).
-#include "traccc/io/csv/dfe.hpp"
 #include "traccc/io/csv/hit.hpp"
+#include "traccc/io/csv/record_reader.hpp"
 
 // System include(s).
 #include <string_view>
@@ -21,6 +21,6 @@ namespace traccc::io::csv {
 /// @param filename The name of the file to read
 /// @return An object that can read the specified CSV file
 ///
-dfe::NamedTupleCsvReader<hit> make_hit_reader(std::string_view filename);
+record_reader<hit> make_hit_reader(std::string_view filename);
 
 }  // namespace traccc::io::csv
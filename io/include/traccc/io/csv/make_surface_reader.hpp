@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,7 +8,7 @@
 #pragma once
 
 // Local include(s).
-#include "traccc/io/csv/dfe.hpp"
+#include "traccc/io/csv/record_reader.hpp"
 #include "traccc/io/csv/surface.hpp"
 
 // System include(s).
@@ -21,7 +21,6 @@ namespace traccc::io::csv {
 /// @param filename The name of the file to read
 /// @return An object that can read the specified CSV file
 ///
-dfe::NamedTupleCsvReader<surface> make_surface_reader(
-    std::string_view filename);
+record_reader<surface> make_surface_reader(std::string_view filename);
 
 }  // namespace traccc::io::csv
@@ -0,0 +1,126 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/mapped_file.hpp"
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace traccc::io::csv {
+
+/// Fast reader for CSV files with a fixed record type
+///
+/// It is a drop-in replacement for @c traccc::io::dfe::NamedTupleCsvReader,
+/// specialised for the simple, numeric CSV files that we read on the hot
+/// paths of the applications. The file is mapped into memory as a whole,
+/// lines and columns are found with @c std::memchr, and the values are
+/// parsed with @c std::from_chars. So no memory is allocated while reading
+/// the records.
+///
+/// Large files can also be split into newline-aligned chunks, which can then
+/// be parsed by multiple threads in parallel.
+///
+/// @tparam RECORD The record type, described with @c DFE_NAMEDTUPLE
+///
+template <typename RECORD>
+class record_reader {
+
+    public:
+    /// Open a CSV file, and interpret its header
+    ///
+    /// Columns of the file that the record does not know about are ignored.
+    ///
+    /// @param filename         The name of the file to read
+    /// @param optional_columns Record fields that the file does not need to
+    ///                         provide
+    ///
+    /// @throw std::runtime_error If the file could not be opened, or a
+    ///        non-optional column is missing from it
+    ///
+    record_reader(std::string_view filename,
+                  const std::vector<std::string>& optional_columns = {});
+
+    /// Read the next record from the file
+    ///
+    /// Fields that the file does not provide are left untouched.
+    ///
+    /// @param record The record to fill
+    /// @return @c true if a record was read, @c false at the end of the file
+    ///
+    /// @throw std::runtime_error If the line could not be parsed
+    ///
+    bool read(RECORD& record);
+
+    /// Split the not yet read part of the file into newline-aligned chunks
+    ///
+    /// @param max_chunks     The maximum number of chunks to split into
+    /// @param min_chunk_size The minimum size of a chunk (in bytes)
+    /// @return The chunks, in the order of the file
+    ///
+    std::vector<std::string_view> split(
+        std::size_t max_chunks, std::size_t min_chunk_size = 1024 * 1024) const;
+
+    /// Read the next record from a chunk of the file
+    ///
+    /// This function does not modify the reader itself, so multiple threads
+    /// may read (different) chunks in parallel.
+    ///
+    /// @param chunk  The chunk to read from, updated to the not yet read part
+    /// @param record The record to fill
+    /// @return @c true if a record was read, @c false at the end of the chunk
+    ///
+    /// @throw std::runtime_error If the line could not be parsed
+    ///
+    bool read(std::string_view& chunk, RECORD& record) const;
+
+    private:
+    /// The number of fields in the record
+    static constexpr std::size_t N_FIELDS =
+        std::tuple_size_v<typename RECORD::Tuple>;
+    /// Function type parsing one field of the record
+    using parser_type = bool (*)(std::string_view, RECORD&);
+
+    /// Get the next line of some text, without the line ending
+    static bool next_line(std::string_view& text, std::string_view& line);
+    /// Parse one (non-empty) line into a record
+    ///
+    /// @param line        The line to parse
+    /// @param record      The record to fill
+    /// @param line_number The number of the line (0 if unknown), for error
+    ///                    messages
+    ///
+    void parse(std::string_view line, RECORD& record,
+               std::size_t line_number) const;
+
+    /// The name of the file, for error messages
+    std::string m_filename;
+    /// The mapped file
+    mapped_file m_file;
+    /// The not yet read part of the file
+    std::string_view m_remaining;
+    /// The number of the current line (for error messages)
+    std::size_t m_line_number = 0;
+    /// The names of the columns in the file
+    std::vector<std::string> m_columns;
+    /// Field parsers for each column of the file (@c nullptr for ignored
+    /// columns)
+    std::vector<parser_type> m_parsers;
+
+};  // class record_reader
+
+}  // namespace traccc::io::csv
+
+// Include the implementation.
+#include "traccc/io/csv/impl/record_reader.ipp"
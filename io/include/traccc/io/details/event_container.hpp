@@ -0,0 +1,62 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace traccc::io::details {
+
+/// @name Description of the multi-event container file format
+///
+/// The files start with an @c event_container_header, followed by an index
+/// of @c event_container_entry objects. With @c n_event_data_types entries
+/// per event, for the events <tt>[first_event, first_event + n_events)</tt>.
+/// The data of each entry starts at an offset (from the beginning of the
+/// file) that is a multiple of @c mapped_soa_alignment. SoA collections
+/// are stored as images in the memory mappable SoA format, particles are
+/// stored as a plain array.
+///
+/// @{
+
+/// Identifier at the start of every event container file
+inline constexpr std::array<char, 8> event_container_magic = {
+    'T', 'R', 'C', 'C', 'E', 'V', 'T', 'S'};
+/// Version of the event container file format
+inline constexpr std::uint32_t event_container_version = 1u;
+/// The number of different types of event data in the file
+inline constexpr std::size_t n_event_data_types = 4u;
+
+/// Header of an event container file
+struct event_container_header {
+    /// File format identifier
+    std::array<char, 8> magic = event_container_magic;
+    /// File format version
+    std::uint32_t version = event_container_version;
+    /// The number of event data types per event
+    std::uint32_t n_types = n_event_data_types;
+    /// The identifier of the first event in the file
+    std::uint64_t first_event = 0u;
+    /// The number of events in the file
+    std::uint64_t n_events = 0u;
+};
+
+/// Index entry of one type of data of one event
+struct event_container_entry {
+    /// Offset of the data from the start of the file (0 if the data is not
+    /// available)
+    std::uint64_t offset = 0u;
+    /// Size of the data in bytes
+    std::uint64_t size = 0u;
+};
+
+/// @}
+
+}  // namespace traccc::io::details
@@ -0,0 +1,59 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace traccc::io::details {
+
+/// @name Description of the memory mappable SoA file format
+///
+/// The files start with a @c mapped_soa_header, followed by one
+/// @c mapped_soa_column description for each variable of the SoA container.
+/// The payload of every variable is stored contiguously, in the same layout
+/// that the variable has in memory, starting at an offset (from the
+/// beginning of the file) that is a multiple of @c mapped_soa_alignment.
+///
+/// @{
+
+/// Identifier at the start of every memory mappable SoA file
+inline constexpr std::array<char, 8> mapped_soa_magic = {'T', 'R', 'C', 'C',
+                                                         'S', 'O', 'A', '\0'};
+/// Version of the memory mappable SoA file format
+inline constexpr std::uint32_t mapped_soa_version = 1u;
+/// Alignment of the variable payloads in the memory mappable SoA files
+inline constexpr std::size_t mapped_soa_alignment = 64u;
+
+/// Header of a memory mappable SoA file
+struct mapped_soa_header {
+    /// File format identifier
+    std::array<char, 8> magic = mapped_soa_magic;
+    /// File format version
+    std::uint32_t version = mapped_soa_version;
+    /// The number of variables in the file
+    std::uint32_t n_variables = 0u;
+    /// The size of the SoA container
+    std::uint64_t size = 0u;
+};
+
+/// Description of one variable in a memory mappable SoA file
+struct mapped_soa_column {
+    /// Offset of the variable's payload from the start of the file
+    std::uint64_t offset = 0u;
+    /// Size of one element of the variable, in bytes
+    std::uint64_t element_size = 0u;
+    /// Number of elements (1 for scalar variables)
+    std::uint64_t count = 0u;
+};
+
+/// @}
+
+}  // namespace traccc::io::details
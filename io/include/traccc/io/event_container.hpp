@@ -0,0 +1,198 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/details/event_container.hpp"
+#include "traccc/io/mapped_file.hpp"
+
+// Project include(s).
+#include "traccc/edm/measurement_collection.hpp"
+#include "traccc/edm/particle.hpp"
+#include "traccc/edm/silicon_cell_collection.hpp"
+#include "traccc/edm/spacepoint_collection.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace traccc::io {
+
+/// Types of event data stored in event container files
+enum class event_data_type : unsigned int {
+    cells = 0u,         ///< Silicon cells
+    measurements = 1u,  ///< Measurements
+    spacepoints = 2u,   ///< Spacepoints (referencing the measurements)
+    particles = 3u      ///< Initial truth particles
+};
+
+/// Get the name of the event container file in a given directory
+///
+/// This is the file that is used for all events, when reading data in the
+/// @c traccc::data_format::container format.
+///
+/// @param directory The directory holding the event container file
+/// @return The absolute name of the event container file
+///
+std::string get_event_container_filename(std::string_view directory);
+
+/// Reader for multi-event container files
+///
+/// The file is mapped into memory once, after which the data of any of its
+/// events can be accessed in any order. The collections can either be
+/// accessed through views pointing straight into the mapped file, or be
+/// copied into host collections.
+///
+/// All member functions are thread safe, so any number of threads may read
+/// (ranges of) events from the same reader in parallel.
+///
+class event_container_reader {
+
+    public:
+    /// Open an event container file
+    ///
+    /// @param filename The name of the file to open
+    ///
+    /// @throw std::runtime_error If the file could not be opened, or it is
+    ///        not an event container file
+    ///
+    explicit event_container_reader(std::string_view filename);
+
+    /// Get a (shared) reader for a given file
+    ///
+    /// Readers are kept open for the rest of the process, so that reading
+    /// events one by one would map the file and read its index only once.
+    /// A new reader is only made if the file was modified since it was
+    /// opened.
+    ///
+    /// @param filename The name of the file to open
+    /// @return A shared reader for the file
+    ///
+    /// @throw std::runtime_error If the file could not be opened, or it is
+    ///        not an event container file
+    ///
+    static std::shared_ptr<const event_container_reader> open(
+        std::string_view filename);
+
+    /// Get the identifier of the first event in the file
+    std::size_t first_event() const;
+    /// Get the number of events in the file
+    std::size_t n_events() const;
+    /// Check whether a given type of data is available for an event
+    bool contains(std::size_t event, event_data_type type) const;
+
+    /// @name Views of the event data in the mapped file
+    /// @{
+
+    /// Get a view of the cells of an event
+    edm::silicon_cell_collection::const_view cells(std::size_t event) const;
+    /// Get a view of the measurements of an event
+    edm::measurement_collection::const_view measurements(
+        std::size_t event) const;
+    /// Get a view of the spacepoints of an event
+    edm::spacepoint_collection::const_view spacepoints(
+        std::size_t event) const;
+    /// Get the particles of an event
+    std::span<const particle> particles(std::size_t event) const;
+
+    /// @}
+
+    /// @name Copies of the event data
+    /// @{
+
+    /// Read the cells of an event into a host collection
+    void read_cells(edm::silicon_cell_collection::host& cells,
+                    std::size_t event) const;
+    /// Read the measurements of an event into a host collection
+    void read_measurements(edm::measurement_collection::host& measurements,
+                           std::size_t event) const;
+    /// Read the spacepoints and measurements of an event into host
+    /// collections
+    void read_spacepoints(edm::spacepoint_collection::host& spacepoints,
+                          edm::measurement_collection::host& measurements,
+                          std::size_t event) const;
+    /// Read the particles of an event into a host collection
+    void read_particles(particle_collection_types::host& particles,
+                        std::size_t event) const;
+
+    /// @}
+
+    private:
+    /// Get the (checked) index entry of one type of data of an event
+    const details::event_container_entry& entry(std::size_t event,
+                                                event_data_type type) const;
+
+    /// The name of the file
+    std::string m_filename;
+    /// The mapped file
+    mapped_file m_file;
+    /// The header of the file
+    details::event_container_header m_header;
+    /// The index of the file
+    std::vector<details::event_container_entry> m_index;
+
+};  // class event_container_reader
+
+/// Writer for multi-event container files
+///
+/// The data of the events can be written in any order, but every type of
+/// data may only be written once for each event. The index of the file is
+/// written when the writer is closed.
+///
+class event_container_writer {
+
+    public:
+    /// Create an event container file
+    ///
+    /// @param filename    The name of the file to create
+    /// @param first_event The identifier of the first event in the file
+    /// @param n_events    The number of events in the file
+    ///
+    /// @throw std::runtime_error If the file could not be created
+    ///
+    event_container_writer(std::string_view filename, std::size_t first_event,
+                           std::size_t n_events);
+    /// Destructor, closing the file if that did not happen yet
+    ~event_container_writer();
+
+    /// Write the cells of an event
+    void write(std::size_t event,
+               edm::silicon_cell_collection::const_view cells);
+    /// Write the measurements of an event
+    void write(std::size_t event,
+               edm::measurement_collection::const_view measurements);
+    /// Write the spacepoints of an event
+    void write(std::size_t event,
+               edm::spacepoint_collection::const_view spacepoints);
+    /// Write the particles of an event
+    void write(std::size_t event,
+               const particle_collection_types::host& particles);
+
+    /// Write the index of the file, and close it
+    void close();
+
+    private:
+    /// Start writing one type of data of an event
+    details::event_container_entry& start_entry(std::size_t event,
+                                                event_data_type type);
+
+    /// The output file
+    std::ofstream m_file;
+    /// The header of the file
+    details::event_container_header m_header;
+    /// The index of the file
+    std::vector<details::event_container_entry> m_index;
+
+};  // class event_container_writer
+
+}  // namespace traccc::io
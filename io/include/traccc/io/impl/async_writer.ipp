@@ -0,0 +1,42 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace traccc::io {
+
+template <typename FUNCTOR>
+void async_writer::submit(FUNCTOR&& task_functor) {
+
+    enqueue(std::make_unique<task<std::decay_t<FUNCTOR>>>(
+        std::forward<FUNCTOR>(task_functor)));
+}
+
+template <typename... ARGS>
+void async_writer::write(std::size_t event, std::string_view directory,
+                         data_format format, ARGS&&... args) {
+
+    submit([event, dir = std::string{directory}, format,
+            data = std::tuple<std::decay_t<ARGS>...>{
+                std::forward<ARGS>(args)...}]() {
+        std::apply(
+            [&](const auto&... arg) {
+                io::write(event, dir, format,
+                          details::async_write_argument(arg)...);
+            },
+            data);
+    });
+}
+
+}  // namespace traccc::io
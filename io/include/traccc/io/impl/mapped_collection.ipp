@@ -0,0 +1,140 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/details/mapped_soa.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/data/vector_view.hpp>
+#include <vecmem/edm/view.hpp>
+
+// System include(s).
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace traccc::io {
+namespace details {
+
+/// Implementation detail for @c traccc::io::details::map_soa
+template <typename TYPE>
+bool map_soa_variable(vecmem::data::vector_view<TYPE>& result,
+                      const std::byte* payload, const mapped_soa_column& column,
+                      std::uint64_t size) {
+
+    if ((column.element_size != sizeof(TYPE)) || (column.count != size)) {
+        return false;
+    }
+    result = {static_cast<typename vecmem::data::vector_view<TYPE>::size_type>(
+                  column.count),
+              reinterpret_cast<TYPE*>(payload)};
+    return true;
+}
+
+/// Implementation detail for @c traccc::io::details::map_soa
+template <typename TYPE>
+bool map_soa_variable(TYPE*& result, const std::byte* payload,
+                      const mapped_soa_column& column, std::uint64_t) {
+
+    if ((column.element_size != sizeof(TYPE)) || (column.count != 1u)) {
+        return false;
+    }
+    result = reinterpret_cast<TYPE*>(payload);
+    return true;
+}
+
+/// Set up a view of an SoA container in mapped memory
+///
+/// @param[in]  data     The beginning of the container's image in memory
+///                      (aligned to @c mapped_soa_alignment)
+/// @param[in]  size     The size of the container's image in memory
+/// @param[in]  filename The name of the mapped file (for error messages)
+/// @param[out] result   The view to set up
+///
+template <typename... VARTYPES>
+void map_soa(const std::byte* data, std::size_t size,
+             std::string_view filename,
+             vecmem::edm::view<vecmem::edm::schema<VARTYPES...>>& result) {
+
+    auto error = [&filename](std::string_view message) {
+        return std::runtime_error(std::string{message} + " in file: " +
+                                  std::string{filename});
+    };
+
+    // Check the header of the image.
+    mapped_soa_header header;
+    if (size < sizeof(header)) {
+        throw error("Missing header");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != mapped_soa_magic) {
+        throw error("Unknown file format");
+    }
+    if (header.version != mapped_soa_version) {
+        throw error("Unsupported file format version");
+    }
+    if (header.n_variables != sizeof...(VARTYPES)) {
+        throw error("Unexpected number of variables");
+    }
+    std::array<mapped_soa_column, sizeof...(VARTYPES)> columns;
+    const std::size_t columns_end = sizeof(header) + sizeof(columns);
+    if (size < columns_end) {
+        throw error("Missing variable descriptions");
+    }
+    std::memcpy(columns.data(), data + sizeof(header), sizeof(columns));
+
+    // Check that all payloads are in the image, properly aligned.
+    for (const mapped_soa_column& column : columns) {
+        if ((column.offset % mapped_soa_alignment != 0) ||
+            (column.offset < columns_end) ||
+            (column.offset + column.count * column.element_size > size)) {
+            throw error("Invalid variable payload");
+        }
+    }
+
+    // Set up the views of the individual variables.
+    using view_type = vecmem::edm::view<vecmem::edm::schema<VARTYPES...>>;
+    result = view_type{static_cast<typename view_type::size_type>(header.size)};
+    const bool success = [&]<std::size_t... INDICES>(
+                             std::index_sequence<INDICES...>) {
+        return (map_soa_variable(result.template get<INDICES>(),
+                                 data + columns[INDICES].offset,
+                                 columns[INDICES], header.size) &&
+                ...);
+    }(std::index_sequence_for<VARTYPES...>{});
+    if (!success) {
+        throw error("Unexpected variable layout");
+    }
+}
+
+}  // namespace details
+
+template <typename COLLECTION>
+mapped_collection<COLLECTION>::mapped_collection(std::string_view filename)
+    : m_file(filename) {
+
+    details::map_soa(m_file.data(), m_file.size(), filename, m_view);
+}
+
+template <typename COLLECTION>
+std::size_t mapped_collection<COLLECTION>::size() const {
+
+    return m_view.capacity();
+}
+
+template <typename COLLECTION>
+auto mapped_collection<COLLECTION>::view() const -> const const_view& {
+
+    return m_view;
+}
+
+}  // namespace traccc::io
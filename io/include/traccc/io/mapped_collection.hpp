@@ -0,0 +1,63 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "traccc/io/mapped_file.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <string_view>
+
+namespace traccc::io {
+
+/// SoA collection read (without copying) from a memory mapped file
+///
+/// The view provided by the object points straight into the mapped file,
+/// which needs to be in the @c traccc::data_format::mapped format. The
+/// view is only valid for as long as the object exists.
+///
+/// Only collections with scalar and (1D) vector variables are supported.
+///
+/// @tparam COLLECTION The (vecmem::edm::container) collection type to read
+///
+template <typename COLLECTION>
+class mapped_collection {
+
+    public:
+    /// The collection type
+    using collection_type = COLLECTION;
+    /// The view type provided by the object
+    using const_view = typename COLLECTION::const_view;
+
+    /// Map a collection file into memory
+    ///
+    /// @param filename The name of the file to map
+    ///
+    /// @throw std::runtime_error If the file could not be mapped, or if it
+    ///        does not hold the expected type of collection
+    ///
+    explicit mapped_collection(std::string_view filename);
+
+    /// Get the size of the collection
+    std::size_t size() const;
+    /// Get a view of the collection
+    const const_view& view() const;
+
+    private:
+    /// The mapped file
+    mapped_file m_file;
+    /// View of the collection in the mapped file
+    const_view m_view;
+
+};  // class mapped_collection
+
+}  // namespace traccc::io
+
+// Include the implementation.
+#include "traccc/io/impl/mapped_collection.ipp"
@@ -0,0 +1,76 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <cstddef>
+#include <streambuf>
+#include <string_view>
+
+namespace traccc::io {
+
+/// Read-only memory mapping of a complete file
+///
+/// The pages of the file are only loaded into memory when they are first
+/// accessed, and they are shared with the operating system's page cache.
+/// So mapping the same file multiple times (even from multiple processes)
+/// does not need any additional memory.
+///
+class mapped_file {
+
+    public:
+    /// Map a file into memory
+    ///
+    /// @param filename The name of the file to map
+    ///
+    /// @throw std::runtime_error If the file could not be mapped
+    ///
+    explicit mapped_file(std::string_view filename);
+    /// Move constructor
+    mapped_file(mapped_file&& parent) noexcept;
+    /// Disallow copying
+    mapped_file(const mapped_file&) = delete;
+    /// Destructor, unmapping the file
+    ~mapped_file();
+
+    /// Move assignment operator
+    mapped_file& operator=(mapped_file&& rhs) noexcept;
+    /// Disallow copying
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    /// Get a pointer to the beginning of the mapped file
+    const std::byte* data() const;
+    /// Get the size of the mapped file
+    std::size_t size() const;
+
+    private:
+    /// Pointer to the mapped memory
+    void* m_data = nullptr;
+    /// Size of the mapped memory
+    std::size_t m_size = 0;
+
+};  // class mapped_file
+
+/// Read-only stream buffer over the contents of a memory mapped file
+///
+/// It lets code written for @c std::istream read straight out of the page
+/// cache, without @c std::ifstream copying the file through its own buffer
+/// first. The mapped file must outlive the buffer.
+///
+class mapped_file_buffer : public std::streambuf {
+
+    public:
+    /// Constructor on top of a mapped file
+    ///
+    /// @param file The mapped file to read
+    ///
+    explicit mapped_file_buffer(const mapped_file& file);
+
+};  // class mapped_file_buffer
+
+}  // namespace traccc::io
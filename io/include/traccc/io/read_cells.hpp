@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,7 @@
 
 // Local include(s).
 #include "traccc/io/data_format.hpp"
+#include "traccc/io/mapped_collection.hpp"
 
 // Project include(s).
 #include "traccc/edm/silicon_cell_collection.hpp"
@@ -64,4 +65,16 @@ void read_cells(edm::silicon_cell_collection::host& cells,
                 data_format format = data_format::csv, bool deduplicate = true,
                 bool use_acts_geometry_id = true);
 
+/// Map cell data into memory, without copying it
+///
+/// The file to map is selected according the naming conventions used in
+/// our data. It needs to be in the @c traccc::data_format::mapped format.
+///
+/// @param event     The event ID to map the cells for
+/// @param directory The directory holding the cell data files
+/// @return The mapped cell collection
+///
+mapped_collection<edm::silicon_cell_collection> map_cells(
+    std::size_t event, std::string_view directory);
+
 }  // namespace traccc::io
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2024 CERN for the benefit of the ACTS project
+ * (c) 2024-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -23,6 +23,11 @@ namespace traccc::io {
 
 /// Populate a @c traccc::detector_design_description object from text files.
 ///
+/// With @c traccc::data_format::binary as the geometry format, both
+/// descriptions are read from a single binary file, previously written by
+/// @c traccc::io::write. In which case the digitization and conditions files
+/// are not used.
+///
 /// @param dd The detector design description object to set up.
 /// @param geometry_file The path to the geometry description file.
 /// @param digitization_file The path to the digitization configuration file.
@@ -11,6 +11,7 @@
 #include "traccc/geometry/detector_conditions_description.hpp"
 #include "traccc/geometry/detector_design_description.hpp"
 #include "traccc/io/data_format.hpp"
+#include "traccc/io/mapped_collection.hpp"
 
 // Project include(s).
 #include "traccc/edm/measurement_collection.hpp"
@@ -58,4 +59,16 @@ std::vector<measurement_id_type> read_measurements(
     const traccc::detector_conditions_description::host* det_cond = nullptr,
     const bool sort_measurements = true, data_format format = data_format::csv);
 
+/// Map measurement data into memory, without copying it
+///
+/// The file to map is selected according the naming conventions used in
+/// our data. It needs to be in the @c traccc::data_format::mapped format.
+///
+/// @param event     The event ID to map the measurements for
+/// @param directory The directory holding the measurement data files
+/// @return The mapped measurement collection
+///
+mapped_collection<edm::measurement_collection> map_measurements(
+    std::size_t event, std::string_view directory);
+
 }  // namespace traccc::io
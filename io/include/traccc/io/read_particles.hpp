@@ -32,6 +32,8 @@ namespace traccc::io {
 /// @param[in]  directory The directory holding the particle data files
 /// @param[in]  format    The format of the particle data files (to read)
 /// @param[in]  filename_postfix Postfix for the particle file name(s)
+///                              (event container files only hold the
+///                              initial particles, and ignore it)
 ///
 void read_particles(particle_collection_types::host &particles,
                     std::size_t event, std::string_view directory,
@@ -0,0 +1,47 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+namespace traccc::io {
+
+/// Check whether files have to be read serially in the current thread
+///
+/// @return @c true if a @c traccc::io::serial_reading object is alive in the
+///         current thread
+///
+bool is_serial_reading();
+
+/// Force the reading of files to be serial in the current thread
+///
+/// Large files are normally parsed in parallel chunks, using TBB. While an
+/// object of this type exists, the readers called from the same thread
+/// process every file in one go instead, without touching TBB at all. This
+/// is needed when reading files before forking the process, since the TBB
+/// runtime can not be used in a child process if it was started before the
+/// fork.
+///
+class serial_reading {
+
+    public:
+    /// Constructor, forcing serial reading
+    serial_reading();
+    /// Disallow copying
+    serial_reading(const serial_reading&) = delete;
+    /// Destructor, restoring the previous setting
+    ~serial_reading();
+
+    /// Disallow copying
+    serial_reading& operator=(const serial_reading&) = delete;
+
+    private:
+    /// The setting before this object was created
+    bool m_previous;
+
+};  // class serial_reading
+
+}  // namespace traccc::io
@@ -92,6 +92,20 @@ void write(std::size_t event, std::string_view directory,
            edm::track_container<default_algebra>::const_view tracks,
            const traccc::host_detector& detector);
 
+/// Write the detector design and conditions descriptions to a file
+///
+/// Only @c traccc::data_format::binary is supported, which produces a file
+/// that @c traccc::io::read_detector_description can read back.
+///
+/// @param filename The name of the file to write the data to
+/// @param format The format of the output file
+/// @param det_desc The detector design description to write
+/// @param det_cond The detector conditions description to write
+///
+void write(std::string_view filename, data_format format,
+           detector_design_description::const_view det_desc,
+           detector_conditions_description::const_view det_cond);
+
 /// Write a digitization configuration to a file
 ///
 /// @param filename The name of the file to write the data to
@@ -0,0 +1,159 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/async_writer.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace traccc::io {
+
+async_writer::async_writer(const config& cfg,
+                           std::unique_ptr<const Logger> ilogger)
+    : messaging(std::move(ilogger)), m_config(cfg) {
+
+    if (m_config.max_queued == 0) {
+        throw std::invalid_argument(
+            "The asynchronous writer needs a queue of at least one element");
+    }
+    m_threads.reserve(m_config.n_threads);
+    try {
+        for (std::size_t i = 0; i < m_config.n_threads; ++i) {
+            m_threads.emplace_back([this]() { process(); });
+        }
+    } catch (...) {
+        // The destructor is not run for a partially constructed object, so
+        // the threads that were started already must be stopped here.
+        stop();
+        throw;
+    }
+    TRACCC_DEBUG("Started " << m_config.n_threads
+                            << " background writer thread(s), with a queue of "
+                            << m_config.max_queued << " task(s)");
+}
+
+async_writer::~async_writer() {
+
+    // Let the threads finish all remaining tasks, and then stop.
+    stop();
+
+    // Exceptions must not leave the destructor, so just report them.
+    if (m_error) {
+        try {
+            std::rethrow_exception(m_error);
+        } catch (const std::exception& ex) {
+            TRACCC_ERROR("Asynchronous write failed: " << ex.what());
+        } catch (...) {
+            TRACCC_ERROR("Asynchronous write failed with an unknown error");
+        }
+    }
+}
+
+void async_writer::flush() {
+
+    {
+        std::unique_lock lock{m_mutex};
+        m_task_done.wait(lock, [this]() { return m_pending == 0; });
+    }
+    rethrow();
+}
+
+std::size_t async_writer::pending() const {
+
+    std::lock_guard lock{m_mutex};
+    return m_pending;
+}
+
+void async_writer::enqueue(std::unique_ptr<task_base> t) {
+
+    // Report earlier errors as soon as possible.
+    rethrow();
+
+    // Without background threads, just execute the task right away.
+    if (m_threads.empty()) {
+        t->execute();
+        return;
+    }
+
+    // Wait for a free slot in the queue, and add the task to it.
+    {
+        std::unique_lock lock{m_mutex};
+        m_slot_freed.wait(
+            lock, [this]() { return m_queue.size() < m_config.max_queued; });
+        m_queue.push_back(std::move(t));
+        ++m_pending;
+    }
+    m_task_added.notify_one();
+}
+
+void async_writer::process() {
+
+    while (true) {
+
+        // Take the next task from the queue.
+        std::unique_ptr<task_base> t;
+        {
+            std::unique_lock lock{m_mutex};
+            m_task_added.wait(
+                lock, [this]() { return m_stop || (!m_queue.empty()); });
+            if (m_queue.empty()) {
+                // The queue is empty and a stop was requested.
+                return;
+            }
+            t = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        m_slot_freed.notify_one();
+
+        // Execute it, remembering the first error.
+        try {
+            t->execute();
+        } catch (...) {
+            std::lock_guard lock{m_mutex};
+            if (!m_error) {
+                m_error = std::current_exception();
+            }
+        }
+
+        // Release the data owned by the task before reporting it as done.
+        t.reset();
+        {
+            std::lock_guard lock{m_mutex};
+            --m_pending;
+        }
+        m_task_done.notify_all();
+    }
+}
+
+void async_writer::stop() {
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_stop = true;
+    }
+    m_task_added.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void async_writer::rethrow() {
+
+    std::exception_ptr error;
+    {
+        std::lock_guard lock{m_mutex};
+        std::swap(error, m_error);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace traccc::io
@@ -0,0 +1,102 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "binary_detector_description.hpp"
+
+#include "read_binary.hpp"
+#include "traccc/io/mapped_file.hpp"
+#include "write_binary.hpp"
+
+// System include(s).
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <stdexcept>
+#include <string>
+
+namespace traccc::io::details {
+namespace {
+
+/// Magic identifier at the start of binary detector description files
+constexpr std::array<char, 8> file_magic = {'T', 'R', 'C', 'C',
+                                            'D', 'E', 'S', 'C'};
+/// The current version of the binary detector description file format
+constexpr std::uint32_t file_version = 1u;
+
+/// Header of binary detector description files
+///
+/// The header is followed by the design and the conditions descriptions, in
+/// the same layout as the one used for SoA containers by the
+/// @c traccc::data_format::binary format.
+///
+struct file_header {
+    /// Magic identifier of the file format
+    std::array<char, 8> magic = file_magic;
+    /// Version of the file format
+    std::uint32_t version = file_version;
+    /// Size of @c traccc::scalar, which the file was written with
+    std::uint32_t scalar_size = sizeof(scalar);
+};
+
+}  // namespace
+
+void write_binary_detector_description(
+    std::string_view filename,
+    detector_design_description::const_view det_desc,
+    detector_conditions_description::const_view det_cond) {
+
+    // Open the output file.
+    std::ofstream out_file(filename.data(), std::ios::binary);
+    if (!out_file.is_open()) {
+        throw std::runtime_error("Could not open file: " +
+                                 std::string{filename});
+    }
+
+    // Write the header, followed by the two descriptions.
+    const file_header header;
+    out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    const detector_design_description::const_device desc_device{det_desc};
+    write_binary_soa_impl<0>(desc_device, out_file);
+    const detector_conditions_description::const_device cond_device{det_cond};
+    write_binary_soa_impl<0>(cond_device, out_file);
+}
+
+void read_binary_detector_description(
+    detector_design_description::host& det_desc,
+    detector_conditions_description::host& det_cond,
+    std::string_view filename) {
+
+    // Map the file into memory, and set up a stream reading from it. Note
+    // that the descriptions are still copied into the (private) memory of
+    // the host containers.
+    const mapped_file file{filename};
+    mapped_file_buffer buffer{file};
+    std::istream in_file(&buffer);
+
+    // Check the header of the file.
+    file_header header;
+    in_file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if ((!in_file) || (header.magic != file_magic) ||
+        (header.version != file_version) ||
+        (header.scalar_size != sizeof(scalar))) {
+        throw std::runtime_error("File \"" + std::string{filename} +
+                                 "\" is not a compatible binary detector "
+                                 "description file");
+    }
+
+    // Read the two descriptions.
+    read_binary_soa_impl<0>(det_desc, in_file);
+    read_binary_soa_impl<0>(det_cond, in_file);
+    if (!in_file) {
+        throw std::runtime_error("File \"" + std::string{filename} +
+                                 "\" is truncated");
+    }
+}
+
+}  // namespace traccc::io::details
@@ -0,0 +1,48 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/geometry/detector_conditions_description.hpp"
+#include "traccc/geometry/detector_design_description.hpp"
+
+// System include(s).
+#include <string_view>
+
+namespace traccc::io::details {
+
+/// Write the detector design and conditions descriptions into a binary file
+///
+/// @param filename The full output filename
+/// @param det_desc The detector design description to write
+/// @param det_cond The detector conditions description to write
+///
+void write_binary_detector_description(
+    std::string_view filename,
+    detector_design_description::const_view det_desc,
+    detector_conditions_description::const_view det_cond);
+
+/// Read the detector design and conditions descriptions from a binary file
+///
+/// The file is read through a memory mapping, without a separate copy in a
+/// stream buffer. But the descriptions are copied into the host containers,
+/// so every process reading the file still holds its own copy of them.
+///
+/// @param det_desc The detector design description to fill
+/// @param det_cond The detector conditions description to fill
+/// @param filename The full input filename
+///
+/// @throw std::runtime_error If the file could not be read, or it is not a
+///        (compatible) binary detector description file
+///
+void read_binary_detector_description(
+    detector_design_description::host& det_desc,
+    detector_conditions_description::host& det_cond,
+    std::string_view filename);
+
+}  // namespace traccc::io::details
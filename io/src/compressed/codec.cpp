@@ -0,0 +1,321 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "codec.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace traccc::io::compressed {
+namespace {
+
+/// The minimum length of a match
+constexpr std::size_t min_match = 4u;
+/// The largest possible match offset
+constexpr std::size_t max_offset = 65535u;
+/// Number of bits used for the hash table of the compressor
+constexpr unsigned int hash_bits = 16u;
+/// Number of bytes at the end of a block that are always stored as literals
+constexpr std::size_t last_literals = 5u;
+/// Minimum distance of the last match from the end of a block
+constexpr std::size_t match_limit = 12u;
+
+/// Read 4 bytes from an (unaligned) position
+std::uint32_t read32(const unsigned char* ptr) {
+
+    std::uint32_t result = 0u;
+    std::memcpy(&result, ptr, sizeof(result));
+    return result;
+}
+
+/// Hash 4 bytes for the match finder of the compressor
+std::uint32_t hash32(std::uint32_t value) {
+
+    return (value * 2654435761u) >> (32u - hash_bits);
+}
+
+/// Append a length that did not fit into a token to the output
+void write_length(std::vector<unsigned char>& output, std::size_t length) {
+
+    while (length >= 255u) {
+        output.push_back(255u);
+        length -= 255u;
+    }
+    output.push_back(static_cast<unsigned char>(length));
+}
+
+/// Append a sequence of literals, and optionally a match, to the output
+void write_sequence(std::vector<unsigned char>& output,
+                    std::span<const unsigned char> literals,
+                    std::size_t offset, std::size_t match_length) {
+
+    // Write the token.
+    const std::size_t match_code =
+        (match_length >= min_match ? match_length - min_match : 0u);
+    output.push_back(
+        static_cast<unsigned char>((std::min<std::size_t>(literals.size(), 15u)
+                                    << 4u) |
+                                   std::min<std::size_t>(match_code, 15u)));
+
+    // Write the literals.
+    if (literals.size() >= 15u) {
+        write_length(output, literals.size() - 15u);
+    }
+    output.insert(output.end(), literals.begin(), literals.end());
+
+    // Write the match, if there is one.
+    if (match_length >= min_match) {
+        output.push_back(static_cast<unsigned char>(offset & 0xffu));
+        output.push_back(static_cast<unsigned char>(offset >> 8u));
+        if (match_code >= 15u) {
+            write_length(output, match_code - 15u);
+        }
+    }
+}
+
+/// Read a length that did not fit into a token
+std::size_t read_length(std::span<const unsigned char> input,
+                        std::size_t& pos) {
+
+    std::size_t result = 0u;
+    unsigned char byte = 255u;
+    while (byte == 255u) {
+        if (pos >= input.size()) {
+            throw std::runtime_error("Truncated compressed block");
+        }
+        byte = input[pos++];
+        result += byte;
+    }
+    return result;
+}
+
+/// Reverse the delta encoding of a column, for a given element type
+template <typename WORD>
+void delta_decode(std::span<unsigned char> data) {
+
+    WORD previous = 0u;
+    for (std::size_t i = 0; i < data.size(); i += sizeof(WORD)) {
+        WORD value;
+        std::memcpy(&value, data.data() + i, sizeof(WORD));
+        previous = static_cast<WORD>(previous + value);
+        std::memcpy(data.data() + i, &previous, sizeof(WORD));
+    }
+}
+
+/// Apply delta encoding to a column, for a given element type
+template <typename WORD>
+void delta_encode(std::span<unsigned char> data) {
+
+    WORD previous = 0u;
+    for (std::size_t i = 0; i < data.size(); i += sizeof(WORD)) {
+        WORD value;
+        std::memcpy(&value, data.data() + i, sizeof(WORD));
+        const WORD delta = static_cast<WORD>(value - previous);
+        std::memcpy(data.data() + i, &delta, sizeof(WORD));
+        previous = value;
+    }
+}
+
+/// Apply / reverse the delta encoding of a column
+void delta_code(std::span<unsigned char> data, std::size_t element_size,
+                bool encode) {
+
+    switch (element_size) {
+        case 1u:
+            encode ? delta_encode<std::uint8_t>(data)
+                   : delta_decode<std::uint8_t>(data);
+            break;
+        case 2u:
+            encode ? delta_encode<std::uint16_t>(data)
+                   : delta_decode<std::uint16_t>(data);
+            break;
+        case 4u:
+            encode ? delta_encode<std::uint32_t>(data)
+                   : delta_decode<std::uint32_t>(data);
+            break;
+        case 8u:
+            encode ? delta_encode<std::uint64_t>(data)
+                   : delta_decode<std::uint64_t>(data);
+            break;
+        default:
+            throw std::runtime_error(
+                "Delta encoding is not supported for elements of " +
+                std::to_string(element_size) + " bytes");
+    }
+}
+
+}  // namespace
+
+std::vector<unsigned char> lz_compress(std::span<const unsigned char> input) {
+
+    std::vector<unsigned char> output;
+    output.reserve(input.size() + input.size() / 255u + 16u);
+
+    // Look for matches, as long as there is enough data left.
+    std::vector<std::uint32_t> table(std::size_t{1u} << hash_bits, 0u);
+    std::size_t anchor = 0u;
+    std::size_t pos = 0u;
+    const std::size_t limit =
+        (input.size() > match_limit ? input.size() - match_limit : 0u);
+    while (pos < limit) {
+
+        // Look for an earlier occurrence of the current 4 bytes.
+        const std::uint32_t sequence = read32(input.data() + pos);
+        std::uint32_t& entry = table[hash32(sequence)];
+        const std::size_t candidate = entry;
+        entry = static_cast<std::uint32_t>(pos);
+        if ((candidate >= pos) || (pos - candidate > max_offset) ||
+            (read32(input.data() + candidate) != sequence)) {
+            // Skip ahead faster in data that does not seem to compress.
+            pos += 1u + ((pos - anchor) >> 6u);
+            continue;
+        }
+
+        // Extend the match as far as possible.
+        std::size_t length = min_match;
+        const std::size_t max_length = input.size() - last_literals - pos;
+        while ((length < max_length) &&
+               (input[candidate + length] == input[pos + length])) {
+            ++length;
+        }
+
+        // Write the sequence.
+        write_sequence(output, input.subspan(anchor, pos - anchor),
+                       pos - candidate, length);
+        pos += length;
+        anchor = pos;
+    }
+
+    // Write all remaining bytes as literals.
+    write_sequence(output, input.subspan(anchor), 0u, 0u);
+    return output;
+}
+
+void lz_decompress(std::span<const unsigned char> input,
+                   std::span<unsigned char> output) {
+
+    std::size_t ipos = 0u;
+    std::size_t opos = 0u;
+    while (true) {
+
+        // Read the token.
+        if (ipos >= input.size()) {
+            throw std::runtime_error("Truncated compressed block");
+        }
+        const unsigned char token = input[ipos++];
+
+        // Copy the literals.
+        std::size_t n_literals = token >> 4u;
+        if (n_literals == 15u) {
+            n_literals += read_length(input, ipos);
+        }
+        if ((n_literals > input.size() - ipos) ||
+            (n_literals > output.size() - opos)) {
+            throw std::runtime_error("Corrupt compressed block");
+        }
+        std::memcpy(output.data() + opos, input.data() + ipos, n_literals);
+        ipos += n_literals;
+        opos += n_literals;
+
+        // The last sequence does not have a match.
+        if (ipos == input.size()) {
+            break;
+        }
+
+        // Copy the match.
+        if (input.size() - ipos < 2u) {
+            throw std::runtime_error("Truncated compressed block");
+        }
+        const std::size_t offset = static_cast<std::size_t>(input[ipos]) |
+                                   (static_cast<std::size_t>(input[ipos + 1u])
+                                    << 8u);
+        ipos += 2u;
+        std::size_t length = (token & 0xfu) + min_match;
+        if ((token & 0xfu) == 15u) {
+            length += read_length(input, ipos);
+        }
+        if ((offset == 0u) || (offset > opos) ||
+            (length > output.size() - opos)) {
+            throw std::runtime_error("Corrupt compressed block");
+        }
+        // Matches may overlap with their own output, so copy them one byte
+        // at a time when they do.
+        unsigned char* dest = output.data() + opos;
+        const unsigned char* source = dest - offset;
+        if (offset >= length) {
+            std::memcpy(dest, source, length);
+        } else {
+            for (std::size_t i = 0; i < length; ++i) {
+                dest[i] = source[i];
+            }
+        }
+        opos += length;
+    }
+
+    if (opos != output.size()) {
+        throw std::runtime_error("Compressed block has an unexpected size (" +
+                                 std::to_string(opos) + " instead of " +
+                                 std::to_string(output.size()) + " bytes)");
+    }
+}
+
+std::vector<unsigned char> encode_column(std::span<const unsigned char> data,
+                                         std::size_t element_size,
+                                         std::uint32_t flags) {
+
+    // Apply the delta encoding on a copy of the data.
+    std::vector<unsigned char> buffer(data.begin(), data.end());
+    if (flags & column_flags::delta_encoded) {
+        delta_code(buffer, element_size, true);
+    }
+
+    // Group the bytes of the elements by their significance.
+    if (flags & column_flags::byte_shuffled) {
+        std::vector<unsigned char> shuffled(buffer.size());
+        const std::size_t count = buffer.size() / element_size;
+        for (std::size_t i = 0; i < count; ++i) {
+            for (std::size_t b = 0; b < element_size; ++b) {
+                shuffled[b * count + i] = buffer[i * element_size + b];
+            }
+        }
+        buffer.swap(shuffled);
+    }
+
+    // Compress the result.
+    return lz_compress(buffer);
+}
+
+void decode_column(std::span<const unsigned char> input,
+                   std::span<unsigned char> output, const file_column& column) {
+
+    // Decompress the payload, directly into the output if possible.
+    std::vector<unsigned char> shuffled;
+    if (column.flags & column_flags::byte_shuffled) {
+        shuffled.resize(output.size());
+        lz_decompress(input, shuffled);
+        const std::size_t count = column.count;
+        const std::size_t element_size = column.element_size;
+        for (std::size_t i = 0; i < count; ++i) {
+            for (std::size_t b = 0; b < element_size; ++b) {
+                output[i * element_size + b] = shuffled[b * count + i];
+            }
+        }
+    } else {
+        lz_decompress(input, output);
+    }
+
+    // Undo the delta encoding.
+    if (column.flags & column_flags::delta_encoded) {
+        delta_code(output, column.element_size, false);
+    }
+}
+
+}  // namespace traccc::io::compressed
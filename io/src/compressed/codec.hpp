@@ -0,0 +1,109 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace traccc::io::compressed {
+
+/// Magic identifier at the start of compressed binary files
+inline constexpr std::array<char, 8> file_magic = {'T', 'R', 'C', 'C',
+                                                   'Z', 'S', 'O', 'A'};
+/// The current version of the compressed binary file format
+inline constexpr std::uint32_t file_version = 1u;
+
+/// Header of a compressed binary SoA file
+struct file_header {
+    /// Magic identifier of the file format
+    std::array<char, 8> magic = file_magic;
+    /// Version of the file format
+    std::uint32_t version = file_version;
+    /// The number of variables (columns) in the file
+    std::uint32_t n_variables = 0u;
+    /// The size of the container
+    std::uint64_t size = 0u;
+};
+
+/// Flags describing how a column was encoded
+enum column_flags : std::uint32_t {
+    /// The elements were replaced by their difference to the previous one
+    delta_encoded = 0x1u,
+    /// The bytes of the elements were grouped by their significance
+    byte_shuffled = 0x2u,
+};
+
+/// Description of one variable (column) in a compressed binary SoA file
+///
+/// The compressed payloads of all columns follow the column descriptions,
+/// one after the other, in the order of the variables.
+///
+struct file_column {
+    /// The size of one element, in bytes
+    std::uint64_t element_size = 0u;
+    /// The number of elements
+    std::uint64_t count = 0u;
+    /// The size of the compressed payload, in bytes
+    std::uint64_t compressed_size = 0u;
+    /// The encoding flags of the column (@c column_flags)
+    std::uint32_t flags = 0u;
+    /// Padding, to keep the size of the structure fixed
+    std::uint32_t padding = 0u;
+};
+
+/// Compress a block of bytes with the in-tree LZ77 codec
+///
+/// The codec follows the design of LZ4: Sequences of literals and matches
+/// (with 16-bit offsets), found with a single hash table lookup per
+/// position. Trading some compression ratio for very fast decompression.
+///
+/// @param input The bytes to compress
+/// @return The compressed block
+///
+std::vector<unsigned char> lz_compress(std::span<const unsigned char> input);
+
+/// Decompress a block of bytes created by @c lz_compress
+///
+/// @param input  The compressed block
+/// @param output The buffer to decompress into, with exactly the size of
+///               the uncompressed data
+///
+/// @throw std::runtime_error If the block is corrupt, or does not match the
+///        size of the output buffer
+///
+void lz_decompress(std::span<const unsigned char> input,
+                   std::span<unsigned char> output);
+
+/// Encode the payload of one column
+///
+/// @param data         The raw payload of the column
+/// @param element_size The size of one element of the column, in bytes
+/// @param flags        The encodings to apply (@c column_flags)
+/// @return The encoded and compressed payload
+///
+std::vector<unsigned char> encode_column(std::span<const unsigned char> data,
+                                         std::size_t element_size,
+                                         std::uint32_t flags);
+
+/// Decode the payload of one column
+///
+/// @param input  The encoded and compressed payload
+/// @param output The buffer to decode into, with exactly the size of the
+///               raw payload of the column
+/// @param column The description of the column
+///
+/// @throw std::runtime_error If the payload is corrupt
+///
+void decode_column(std::span<const unsigned char> input,
+                   std::span<unsigned char> output, const file_column& column);
+
+}  // namespace traccc::io::compressed
@@ -0,0 +1,250 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Local include(s).
+#include "../parallel_chunks.hpp"
+#include "codec.hpp"
+
+// Project include(s).
+#include "traccc/io/mapped_file.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/jagged_device_vector.hpp>
+#include <vecmem/edm/device.hpp>
+#include <vecmem/edm/host.hpp>
+
+// System include(s).
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace traccc::io::details {
+
+/// Encoding flags to use for a given element type
+///
+/// Delta encoding is applied to all types that can be treated as plain
+/// unsigned integers. (Channel indices, module indices, identifiers, etc.)
+/// While all multi-byte types get their bytes shuffled.
+///
+template <typename TYPE>
+constexpr std::uint32_t compressed_soa_flags() {
+
+    std::uint32_t flags = 0u;
+    if constexpr (std::has_unique_object_representations_v<TYPE> &&
+                  ((sizeof(TYPE) == 1u) || (sizeof(TYPE) == 2u) ||
+                   (sizeof(TYPE) == 4u) || (sizeof(TYPE) == 8u))) {
+        flags |= compressed::column_flags::delta_encoded;
+    }
+    if constexpr (sizeof(TYPE) > 1u) {
+        flags |= compressed::column_flags::byte_shuffled;
+    }
+    return flags;
+}
+
+/// Implementation detail for @c traccc::io::details::write_compressed_soa
+template <typename TYPE>
+std::span<const unsigned char> compressed_soa_input(
+    const TYPE& var, compressed::file_column& column) {
+
+    // Make sure that the type works.
+    static_assert(std::is_standard_layout_v<TYPE>,
+                  "Scalar type does not have a standard layout.");
+
+    // Describe the scalar variable.
+    column.element_size = sizeof(TYPE);
+    column.count = 1u;
+    column.flags = compressed_soa_flags<TYPE>();
+    return {reinterpret_cast<const unsigned char*>(&var), sizeof(TYPE)};
+}
+
+/// Implementation detail for @c traccc::io::details::write_compressed_soa
+template <typename TYPE>
+std::span<const unsigned char> compressed_soa_input(
+    const vecmem::device_vector<TYPE>& var, compressed::file_column& column) {
+
+    // Make sure that the type works.
+    static_assert(std::is_standard_layout_v<TYPE>,
+                  "Vector type does not have a standard layout.");
+
+    // Describe the vector variable.
+    column.element_size = sizeof(TYPE);
+    column.count = var.size();
+    column.flags = compressed_soa_flags<TYPE>();
+    return {reinterpret_cast<const unsigned char*>(var.data()),
+            var.size() * sizeof(TYPE)};
+}
+
+/// Jagged vectors can not be written in the compressed format
+template <typename TYPE>
+std::span<const unsigned char> compressed_soa_input(
+    const vecmem::jagged_device_vector<TYPE>& var,
+    compressed::file_column& column) = delete;
+
+/// Function writing an SoA container into a compressed binary file
+///
+/// Every variable is encoded and compressed independently, in parallel.
+///
+/// @param filename The full output filename
+/// @param container The container to write
+///
+template <typename... VARTYPES, template <typename> class INTERFACE>
+void write_compressed_soa(
+    std::string_view filename,
+    const vecmem::edm::device<vecmem::edm::schema<VARTYPES...>, INTERFACE>&
+        container) {
+
+    // Describe all variables.
+    static constexpr std::size_t N_VARIABLES = sizeof...(VARTYPES);
+    std::array<compressed::file_column, N_VARIABLES> columns;
+    std::array<std::span<const unsigned char>, N_VARIABLES> payloads;
+    [&]<std::size_t... INDICES>(std::index_sequence<INDICES...>) {
+        ((payloads[INDICES] = compressed_soa_input(
+              container.template get<INDICES>(), columns[INDICES])),
+         ...);
+    }(std::index_sequence_for<VARTYPES...>{});
+
+    // Compress the variables in parallel.
+    std::array<std::vector<unsigned char>, N_VARIABLES> compressed_payloads;
+    for_each_chunk(N_VARIABLES, [&](std::size_t i) {
+        compressed_payloads[i] = compressed::encode_column(
+            payloads[i], columns[i].element_size, columns[i].flags);
+        columns[i].compressed_size = compressed_payloads[i].size();
+    });
+
+    // Write the header, the variable descriptions and the payloads.
+    compressed::file_header header;
+    header.n_variables = N_VARIABLES;
+    header.size = container.size();
+    std::ofstream out_file(filename.data(), std::ios::binary);
+    out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out_file.write(reinterpret_cast<const char*>(columns.data()),
+                   sizeof(columns));
+    for (const std::vector<unsigned char>& payload : compressed_payloads) {
+        out_file.write(reinterpret_cast<const char*>(payload.data()),
+                       static_cast<std::streamsize>(payload.size()));
+    }
+}
+
+/// Implementation detail for @c traccc::io::details::read_compressed_soa
+template <typename TYPE>
+std::span<unsigned char> compressed_soa_output(
+    TYPE& var, const compressed::file_column& column, std::uint64_t) {
+
+    // Make sure that the type works.
+    static_assert(std::is_standard_layout_v<TYPE>,
+                  "Scalar type does not have a standard layout.");
+
+    // Check the description of the variable.
+    if ((column.element_size != sizeof(TYPE)) || (column.count != 1u)) {
+        throw std::runtime_error(
+            "Scalar variable does not match the compressed file's content");
+    }
+    return {reinterpret_cast<unsigned char*>(&var), sizeof(TYPE)};
+}
+
+/// Implementation detail for @c traccc::io::details::read_compressed_soa
+template <typename TYPE, typename ALLOC>
+std::span<unsigned char> compressed_soa_output(
+    std::vector<TYPE, ALLOC>& var, const compressed::file_column& column,
+    std::uint64_t size) {
+
+    // Make sure that the type works.
+    static_assert(std::is_standard_layout_v<TYPE>,
+                  "Vector type does not have a standard layout.");
+
+    // Check the description of the variable, and set up the vector. All
+    // vector variables must have the size of the container.
+    if ((column.element_size != sizeof(TYPE)) || (column.count != size)) {
+        throw std::runtime_error(
+            "Vector variable does not match the compressed file's content");
+    }
+    var.resize(column.count);
+    return {reinterpret_cast<unsigned char*>(var.data()),
+            var.size() * sizeof(TYPE)};
+}
+
+/// Jagged vectors can not be read from the compressed format
+template <typename TYPE, typename ALLOC1, typename ALLOC2>
+std::span<unsigned char> compressed_soa_output(
+    std::vector<std::vector<TYPE, ALLOC2>, ALLOC1>& var,
+    const compressed::file_column& column, std::uint64_t size) = delete;
+
+/// Function reading an SoA container from a compressed binary file
+///
+/// The variables are decompressed in parallel, straight into the result
+/// container.
+///
+/// @param result   The container to fill
+/// @param filename The full input filename
+///
+template <typename... VARTYPES, template <typename> class INTERFACE>
+void read_compressed_soa(
+    vecmem::edm::host<vecmem::edm::schema<VARTYPES...>, INTERFACE>& result,
+    std::string_view filename) {
+
+    // Map the file into memory.
+    const mapped_file file{filename};
+    const auto* data = reinterpret_cast<const unsigned char*>(file.data());
+
+    // Check its header.
+    static constexpr std::size_t N_VARIABLES = sizeof...(VARTYPES);
+    compressed::file_header header;
+    std::array<compressed::file_column, N_VARIABLES> columns;
+    if (file.size() < sizeof(header) + sizeof(columns)) {
+        throw std::runtime_error("File \"" + std::string{filename} +
+                                 "\" is too small");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if ((header.magic != compressed::file_magic) ||
+        (header.version != compressed::file_version) ||
+        (header.n_variables != N_VARIABLES)) {
+        throw std::runtime_error("File \"" + std::string{filename} +
+                                 "\" is not a compatible compressed file");
+    }
+    std::memcpy(columns.data(), data + sizeof(header), sizeof(columns));
+
+    // Find the payloads of all variables.
+    std::array<std::span<const unsigned char>, N_VARIABLES> payloads;
+    std::uint64_t offset = sizeof(header) + sizeof(columns);
+    for (std::size_t i = 0; i < N_VARIABLES; ++i) {
+        if (columns[i].compressed_size > file.size() - offset) {
+            throw std::runtime_error("File \"" + std::string{filename} +
+                                     "\" is truncated");
+        }
+        payloads[i] = {data + offset, columns[i].compressed_size};
+        offset += columns[i].compressed_size;
+    }
+
+    // Set up the result container.
+    result.resize(header.size);
+    std::array<std::span<unsigned char>, N_VARIABLES> outputs;
+    [&]<std::size_t... INDICES>(std::index_sequence<INDICES...>) {
+        ((outputs[INDICES] =
+              compressed_soa_output(result.template get<INDICES>(),
+                                    columns[INDICES], header.size)),
+         ...);
+    }(std::index_sequence_for<VARTYPES...>{});
+
+    // Decompress the variables in parallel.
+    for_each_chunk(N_VARIABLES, [&](std::size_t i) {
+        compressed::decode_column(payloads[i], outputs[i], columns[i]);
+    });
+}
+
+}  // namespace traccc::io::details
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,9 +10,9 @@
 
 namespace traccc::io::csv {
 
-dfe::NamedTupleCsvReader<cell> make_cell_reader(std::string_view filename) {
+record_reader<cell> make_cell_reader(std::string_view filename) {
 
-    return {filename.data(),
+    return {filename,
             {"geometry_id", "measurement_id", "cannel0", "channel1",
              "timestamp", "value"}};
 }
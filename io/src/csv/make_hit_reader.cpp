@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,9 +10,9 @@
 
 namespace traccc::io::csv {
 
-dfe::NamedTupleCsvReader<hit> make_hit_reader(std::string_view filename) {
+record_reader<hit> make_hit_reader(std::string_view filename) {
 
-    return {filename.data(),
+    return {filename,
             {"particle_id", "geometry_id", "tx", "ty", "tz", "tt", "tpx", "tpy",
              "tpz", "te", "deltapx", "deltapy", "deltapz", "deltae", "index"}};
 }
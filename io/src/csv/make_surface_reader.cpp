@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -10,10 +10,9 @@
 
 namespace traccc::io::csv {
 
-dfe::NamedTupleCsvReader<surface> make_surface_reader(
-    std::string_view filename) {
+record_reader<surface> make_surface_reader(std::string_view filename) {
 
-    return {filename.data(),
+    return {filename,
             {"geometry_id", "cx", "cy", "cz", "rot_xu", "rot_xv", "rot_xw",
              "rot_zu", "rot_zv", "rot_zw"}};
 }
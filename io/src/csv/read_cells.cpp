@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,102 +8,79 @@
 // Local include(s).
 #include "read_cells.hpp"
 
+#include "../parallel_chunks.hpp"
 #include "traccc/io/csv/make_cell_reader.hpp"
 #include "traccc/utils/logging.hpp"
+#include "traccc/utils/radix_sort.hpp"
 
 // System include(s).
-#include <algorithm>
-#include <cassert>
-#include <iostream>
+#include <cstdint>
 #include <map>
-#include <set>
+#include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
 namespace {
 
-/// Comparator used for sorting cells. This sorting is one of the assumptions
-/// made in the clusterization algorithm
-struct cell_order {
-    bool operator()(const traccc::io::csv::cell& lhs,
-                    const traccc::io::csv::cell& rhs) const {
-        if (lhs.channel1 != rhs.channel1) {
-            return (lhs.channel1 < rhs.channel1);
-        } else {
-            return (lhs.channel0 < rhs.channel0);
-        }
-    }
-};  // struct cell_order
-
-std::map<std::uint64_t, std::vector<traccc::io::csv::cell> >
-read_deduplicated_cells(std::string_view filename,
-                        std::unique_ptr<const traccc::Logger> ilogger) {
-    TRACCC_LOCAL_LOGGER(std::move(ilogger));
+/// Read all cells of a file, in the order of the file
+///
+/// Large files are parsed in newline-aligned chunks in parallel. The results
+/// of the chunks are concatenated in the order of the chunks, so the result
+/// is the same as with a sequential read.
+///
+std::vector<traccc::io::csv::cell> read_all_cells(std::string_view filename) {
 
-    // Temporary storage for all the cells and modules.
-    std::map<std::uint64_t,
-             std::map<traccc::io::csv::cell, float, ::cell_order> >
-        cellMap;
-
-    // Construct the cell reader object.
+    // Construct the cell reader object, and split the file into chunks.
     auto reader = traccc::io::csv::make_cell_reader(filename);
-
-    // Read all cells from input file.
-    traccc::io::csv::cell iocell;
-    unsigned int nduplicates = 0;
-    while (reader.read(iocell)) {
-
-        // Add the cell to the module. At this point the module link of the
-        // cells is not set up correctly yet.
-        auto ret = cellMap[iocell.geometry_id].insert({iocell, iocell.value});
-        if (ret.second == false) {
-            cellMap[iocell.geometry_id].at(iocell) += iocell.value;
-            ++nduplicates;
+    const std::vector<std::string_view> chunks =
+        reader.split(traccc::io::details::max_parallel_chunks());
+
+    // Read the cells of all chunks.
+    std::vector<std::vector<traccc::io::csv::cell> > chunk_cells(
+        chunks.size());
+    traccc::io::details::for_each_chunk(chunks.size(), [&](std::size_t i) {
+        std::string_view chunk = chunks[i];
+        traccc::io::csv::cell iocell;
+        while (reader.read(chunk, iocell)) {
+            chunk_cells[i].push_back(iocell);
         }
-    }
-    if (nduplicates > 0) {
-        TRACCC_WARNING(nduplicates << " duplicate cells found in " << filename);
-    }
+    });
 
-    // Create and fill the result container. With summed activation values.
-    std::map<std::uint64_t, std::vector<traccc::io::csv::cell> > result;
-    for (const auto& [geometry_id, cells] : cellMap) {
-        for (const auto& [cell, value] : cells) {
-            traccc::io::csv::cell summed_cell{cell};
-            summed_cell.value = value;
-            result[geometry_id].push_back(summed_cell);
-        }
+    // Concatenate the results of the chunks.
+    if (chunk_cells.size() == 1u) {
+        return std::move(chunk_cells.front());
+    }
+    std::vector<traccc::io::csv::cell> result;
+    for (const std::vector<traccc::io::csv::cell>& cells : chunk_cells) {
+        result.insert(result.end(), cells.begin(), cells.end());
     }
-
-    // Return the container.
     return result;
 }
 
-std::map<std::uint64_t, std::vector<traccc::io::csv::cell> > read_all_cells(
-    std::string_view filename) {
-
-    // The result container.
-    std::map<std::uint64_t, std::vector<traccc::io::csv::cell> > result;
-
-    // Construct the cell reader object.
-    auto reader = traccc::io::csv::make_cell_reader(filename);
-
-    // Read all cells from input file.
-    traccc::io::csv::cell iocell;
-    while (reader.read(iocell)) {
-
-        // Add the cell to the module. At this point the module link of the
-        // cells is not set up correctly yet.
-        result[iocell.geometry_id].push_back(iocell);
-    }
+/// Sort cells by module, and by (channel1, channel0) inside of the modules
+///
+/// The sorting inside of the modules is one of the assumptions made in the
+/// clusterization algorithm. The sort is stable, so cells with the same
+/// coordinates keep the order in which they were read.
+///
+void sort_cells(std::vector<traccc::io::csv::cell>& cells) {
+
+    traccc::radix_sort(cells, [](const traccc::io::csv::cell& cell) {
+        return (static_cast<std::uint64_t>(cell.channel1) << 32u) |
+               cell.channel0;
+    });
+    traccc::radix_sort(cells, [](const traccc::io::csv::cell& cell) {
+        return cell.geometry_id;
+    });
+}
 
-    // Sort the cells. Deduplication or not, they do need to be sorted.
-    for (auto& [_, cells] : result) {
-        std::sort(cells.begin(), cells.end(), ::cell_order());
-    }
+/// Check whether two cells describe the same channel of the same module
+bool same_channel(const traccc::io::csv::cell& lhs,
+                  const traccc::io::csv::cell& rhs) {
 
-    // Return the container.
-    return result;
+    return (lhs.geometry_id == rhs.geometry_id) &&
+           (lhs.channel0 == rhs.channel0) && (lhs.channel1 == rhs.channel1);
 }
 
 }  // namespace
@@ -116,13 +93,14 @@ void read_cells(edm::silicon_cell_collection::host& cells,
                 const detector_conditions_description::host* det_cond,
                 bool deduplicate, bool use_acts_geometry_id) {
 
+    TRACCC_LOCAL_LOGGER(std::move(ilogger));
+
     // Clear the output container.
     cells.resize(0u);
 
-    // Get the cells and modules into an intermediate format.
-    auto cellsMap =
-        (deduplicate ? read_deduplicated_cells(filename, ilogger->clone())
-                     : read_all_cells(filename));
+    // Read all cells into a flat buffer, and sort them.
+    std::vector<csv::cell> iocells = read_all_cells(filename);
+    sort_cells(iocells);
 
     // If there is a detector description object, build a map of geometry IDs
     // to indices inside the detector description.
@@ -140,28 +118,43 @@ void read_cells(edm::silicon_cell_collection::host& cells,
         }
     }
 
-    // Fill the output containers with the ordered cells and modules.
-    for (const auto& [geometry_id, cellz] : cellsMap) {
+    // Fill the output container with the ordered cells, in a single pass.
+    // Summing up the activations of duplicate cells (in the order in which
+    // they were read), if requested.
+    cells.reserve(iocells.size());
+    unsigned int ddIndex = 0;
+    unsigned int nduplicates = 0;
+    for (std::size_t i = 0; i < iocells.size(); ++i) {
+
+        const csv::cell& cell = iocells[i];
+        const bool new_module =
+            (i == 0) || (cell.geometry_id != iocells[i - 1].geometry_id);
 
-        // Figure out the index of the detector description object, for this
-        // group of cells.
-        unsigned int ddIndex = 0;
+        // Add the activation of duplicate cells to the previous cell.
+        if (deduplicate && !new_module && same_channel(cell, iocells[i - 1])) {
+            cells.activation().back() += cell.value;
+            ++nduplicates;
+            continue;
+        }
 
-        if (det_cond) {
-            auto it = geomIdMap.find(geometry_id);
+        // Figure out the index of the detector description object, for each
+        // new module.
+        if (new_module && det_cond) {
+            auto it = geomIdMap.find(cell.geometry_id);
             if (it == geomIdMap.end()) {
                 throw std::runtime_error("Could not find geometry ID (" +
-                                         std::to_string(geometry_id) +
+                                         std::to_string(cell.geometry_id) +
                                          ") in the detector description");
             }
             ddIndex = it->second;
         }
 
-        // Add the cells to the output.
-        for (const csv::cell& cell : cellz) {
-            cells.push_back({cell.channel0, cell.channel1, cell.value,
-                             cell.timestamp, ddIndex});
-        }
+        // Add the cell to the output.
+        cells.push_back({cell.channel0, cell.channel1, cell.value,
+                         cell.timestamp, ddIndex});
+    }
+    if (nduplicates > 0) {
+        TRACCC_WARNING(nduplicates << " duplicate cells found in " << filename);
     }
 }
 
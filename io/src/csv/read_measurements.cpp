@@ -8,6 +8,7 @@
 // Local include(s).
 #include "read_measurements.hpp"
 
+#include "../parallel_chunks.hpp"
 #include "traccc/io/csv/make_measurement_edm.hpp"
 #include "traccc/io/csv/make_measurement_reader.hpp"
 
@@ -24,8 +25,11 @@ std::vector<measurement_id_type> read_measurements(
     const traccc::detector_conditions_description::host* det_cond,
     const bool do_sort) {
 
-    // Construct the measurement reader object.
+    // Construct the measurement reader object, and split the file into
+    // chunks.
     auto reader = make_measurement_reader(filename);
+    const std::vector<std::string_view> chunks =
+        reader.split(traccc::io::details::max_parallel_chunks());
 
     // For Acts data, build a map of acts->detray geometry IDs
     std::map<geometry_id, geometry_id> acts_to_detray_id;
@@ -51,19 +55,34 @@ std::vector<measurement_id_type> read_measurements(
         }
     }
 
-    // Read the measurements from the input file.
-    csv::measurement iomeas;
-    while (reader.read(iomeas)) {
-
-        // Construct the measurement object.
-        measurements.resize(measurements.size() + 1u);
-        edm::measurement meas = measurements.at(measurements.size() - 1u);
-        make_measurement_edm(
-            iomeas, meas, (detector == nullptr ? nullptr : &acts_to_detray_id),
-            det_desc,
-            (det_cond == nullptr ? nullptr
-                                 : &geometry_id_to_detector_description_index));
+    // Read the measurements from the input file, in parallel chunks.
+    std::vector<std::vector<csv::measurement>> chunk_meas(chunks.size());
+    traccc::io::details::for_each_chunk(chunks.size(), [&](std::size_t i) {
+        std::string_view chunk = chunks[i];
+        csv::measurement iomeas;
+        while (reader.read(chunk, iomeas)) {
+            chunk_meas[i].push_back(iomeas);
+        }
+    });
+
+    // Construct the measurement objects, at the end of the output collection,
+    // in the order of the file.
+    std::vector<std::size_t> offsets(chunks.size() + 1u, measurements.size());
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+        offsets[i + 1] = offsets[i] + chunk_meas[i].size();
     }
+    measurements.resize(offsets.back());
+    traccc::io::details::for_each_chunk(chunks.size(), [&](std::size_t i) {
+        for (std::size_t j = 0; j < chunk_meas[i].size(); ++j) {
+            edm::measurement meas = measurements.at(offsets[i] + j);
+            make_measurement_edm(
+                chunk_meas[i][j], meas,
+                (detector == nullptr ? nullptr : &acts_to_detray_id), det_desc,
+                (det_cond == nullptr
+                     ? nullptr
+                     : &geometry_id_to_detector_description_index));
+        }
+    });
 
     // Contains the index of the new position at the entry of the old position
     std::vector<measurement_id_type> new_idx_map(measurements.size());
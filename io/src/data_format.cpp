@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -28,6 +28,15 @@ std::ostream& operator<<(std::ostream& out, data_format format) {
         case data_format::obj:
             out << "wavefront obj";
             break;
+        case data_format::mapped:
+            out << "mapped binary";
+            break;
+        case data_format::container:
+            out << "event container";
+            break;
+        case data_format::compressed:
+            out << "compressed binary";
+            break;
         default:
             out << "?!?unknown?!?";
             break;
@@ -0,0 +1,370 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/event_container.hpp"
+
+#include "read_binary.hpp"
+#include "traccc/io/utils.hpp"
+#include "write_binary.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+namespace traccc::io {
+namespace {
+
+/// Round an offset up to the alignment of the SoA images
+std::uint64_t align(std::uint64_t offset) {
+
+    return (offset + details::mapped_soa_alignment - 1) /
+           details::mapped_soa_alignment * details::mapped_soa_alignment;
+}
+
+/// The offset of the first payload in a file with a given number of events
+std::uint64_t payload_start(std::uint64_t n_events) {
+
+    return align(sizeof(details::event_container_header) +
+                 n_events * details::n_event_data_types *
+                     sizeof(details::event_container_entry));
+}
+
+/// A reader kept open by @c traccc::io::event_container_reader::open
+struct cached_reader {
+    /// The reader of the file
+    std::shared_ptr<const event_container_reader> reader;
+    /// The modification time of the file when it was opened
+    std::filesystem::file_time_type modified;
+};
+
+/// The readers kept open for the lifetime of the process
+struct reader_cache {
+    /// Mutex protecting the map
+    std::mutex mutex;
+    /// The readers, by file name
+    std::map<std::string, cached_reader, std::less<>> readers;
+};
+
+/// Get the process-wide cache of readers
+reader_cache& get_reader_cache() {
+
+    static reader_cache cache;
+    return cache;
+}
+
+}  // namespace
+
+std::string get_event_container_filename(std::string_view directory) {
+
+    return get_absolute_path(
+        (std::filesystem::path(directory) / "events.trcc").native());
+}
+
+event_container_reader::event_container_reader(std::string_view filename)
+    : m_filename(filename), m_file(filename) {
+
+    // Check the header of the file.
+    if (m_file.size() < sizeof(m_header)) {
+        throw std::runtime_error("Missing header in file: " + m_filename);
+    }
+    std::memcpy(&m_header, m_file.data(), sizeof(m_header));
+    if (m_header.magic != details::event_container_magic) {
+        throw std::runtime_error("Unknown file format in file: " + m_filename);
+    }
+    if (m_header.version != details::event_container_version) {
+        throw std::runtime_error("Unsupported file format version in file: " +
+                                 m_filename);
+    }
+    if (m_header.n_types != details::n_event_data_types) {
+        throw std::runtime_error("Unexpected number of data types in file: " +
+                                 m_filename);
+    }
+
+    // Read the index, and make sure that all of its entries are valid. The
+    // number of events is checked against the size of the file first, so
+    // that a corrupt header could not make the index size overflow.
+    const std::size_t max_events =
+        (m_file.size() - sizeof(m_header)) /
+        (details::n_event_data_types * sizeof(details::event_container_entry));
+    if (m_header.n_events > max_events) {
+        throw std::runtime_error("Missing index in file: " + m_filename);
+    }
+    const std::size_t n_entries =
+        static_cast<std::size_t>(m_header.n_events) *
+        details::n_event_data_types;
+    m_index.resize(n_entries);
+    std::memcpy(m_index.data(), m_file.data() + sizeof(m_header),
+                n_entries * sizeof(details::event_container_entry));
+    if (std::any_of(m_index.begin(), m_index.end(),
+                    [this](const details::event_container_entry& e) {
+                        return (e.offset != 0u) &&
+                               ((e.offset % details::mapped_soa_alignment !=
+                                 0) ||
+                                (e.offset > m_file.size()) ||
+                                (e.size > m_file.size() - e.offset));
+                    })) {
+        throw std::runtime_error("Invalid index in file: " + m_filename);
+    }
+}
+
+std::shared_ptr<const event_container_reader> event_container_reader::open(
+    std::string_view filename) {
+
+    // Return an existing reader if possible, or create a new one.
+    // A missing file is reported by the reader's constructor.
+    reader_cache& cache = get_reader_cache();
+    std::error_code ec;
+    const std::filesystem::file_time_type modified =
+        std::filesystem::last_write_time(std::filesystem::path{filename}, ec);
+    std::lock_guard lock{cache.mutex};
+    cached_reader& reader = cache.readers[std::string{filename}];
+    if (!reader.reader || (reader.modified != modified)) {
+        reader.reader = std::make_shared<const event_container_reader>(filename);
+        reader.modified = modified;
+    }
+    return reader.reader;
+}
+
+std::size_t event_container_reader::first_event() const {
+
+    return m_header.first_event;
+}
+
+std::size_t event_container_reader::n_events() const {
+
+    return m_header.n_events;
+}
+
+bool event_container_reader::contains(std::size_t event,
+                                      event_data_type type) const {
+
+    if ((event < m_header.first_event) ||
+        (event >= m_header.first_event + m_header.n_events)) {
+        return false;
+    }
+    return m_index[(event - m_header.first_event) *
+                       details::n_event_data_types +
+                   static_cast<std::size_t>(type)]
+               .offset != 0u;
+}
+
+const details::event_container_entry& event_container_reader::entry(
+    std::size_t event, event_data_type type) const {
+
+    if (!contains(event, type)) {
+        throw std::out_of_range("Requested data not available for event " +
+                                std::to_string(event) +
+                                " in file: " + m_filename);
+    }
+    return m_index[(event - m_header.first_event) *
+                       details::n_event_data_types +
+                   static_cast<std::size_t>(type)];
+}
+
+edm::silicon_cell_collection::const_view event_container_reader::cells(
+    std::size_t event) const {
+
+    const details::event_container_entry& e =
+        entry(event, event_data_type::cells);
+    edm::silicon_cell_collection::const_view result;
+    details::map_soa(m_file.data() + e.offset, e.size, m_filename, result);
+    return result;
+}
+
+edm::measurement_collection::const_view event_container_reader::measurements(
+    std::size_t event) const {
+
+    const details::event_container_entry& e =
+        entry(event, event_data_type::measurements);
+    edm::measurement_collection::const_view result;
+    details::map_soa(m_file.data() + e.offset, e.size, m_filename, result);
+    return result;
+}
+
+edm::spacepoint_collection::const_view event_container_reader::spacepoints(
+    std::size_t event) const {
+
+    const details::event_container_entry& e =
+        entry(event, event_data_type::spacepoints);
+    edm::spacepoint_collection::const_view result;
+    details::map_soa(m_file.data() + e.offset, e.size, m_filename, result);
+    return result;
+}
+
+std::span<const particle> event_container_reader::particles(
+    std::size_t event) const {
+
+    const details::event_container_entry& e =
+        entry(event, event_data_type::particles);
+    if (e.size % sizeof(particle) != 0) {
+        throw std::runtime_error("Invalid particle data for event " +
+                                 std::to_string(event) +
+                                 " in file: " + m_filename);
+    }
+    return {reinterpret_cast<const particle*>(m_file.data() + e.offset),
+            e.size / sizeof(particle)};
+}
+
+void event_container_reader::read_cells(
+    edm::silicon_cell_collection::host& cells, std::size_t event) const {
+
+    details::copy_mapped_soa(this->cells(event), cells);
+}
+
+void event_container_reader::read_measurements(
+    edm::measurement_collection::host& measurements, std::size_t event) const {
+
+    details::copy_mapped_soa(this->measurements(event), measurements);
+}
+
+void event_container_reader::read_spacepoints(
+    edm::spacepoint_collection::host& spacepoints,
+    edm::measurement_collection::host& measurements, std::size_t event) const {
+
+    details::copy_mapped_soa(this->spacepoints(event), spacepoints);
+    read_measurements(measurements, event);
+}
+
+void event_container_reader::read_particles(
+    particle_collection_types::host& particles, std::size_t event) const {
+
+    const std::span<const particle> mapped = this->particles(event);
+    particles.assign(mapped.begin(), mapped.end());
+}
+
+event_container_writer::event_container_writer(std::string_view filename,
+                                               std::size_t first_event,
+                                               std::size_t n_events)
+    : m_file(std::string{filename}, std::ios::binary),
+      m_index(n_events * details::n_event_data_types) {
+
+    if (!m_file.good()) {
+        throw std::runtime_error("Could not create file: " +
+                                 std::string{filename});
+    }
+
+    // Make sure that a reader opened for an earlier version of the file
+    // would not be handed out anymore.
+    reader_cache& cache = get_reader_cache();
+    std::lock_guard lock{cache.mutex};
+    if (auto it = cache.readers.find(filename); it != cache.readers.end()) {
+        cache.readers.erase(it);
+    }
+
+    // Leave space for the header and the index, which are only written once
+    // all payloads are in place.
+    m_header.first_event = first_event;
+    m_header.n_events = n_events;
+    m_file.seekp(static_cast<std::streamoff>(payload_start(n_events)));
+}
+
+event_container_writer::~event_container_writer() {
+
+    // Errors can not be reported from here. Users should call close()
+    // explicitly, if they want to know about those.
+    try {
+        close();
+    } catch (...) {
+    }
+}
+
+details::event_container_entry& event_container_writer::start_entry(
+    std::size_t event, event_data_type type) {
+
+    if (!m_file.is_open()) {
+        throw std::logic_error("The event container file is already closed");
+    }
+    if ((event < m_header.first_event) ||
+        (event >= m_header.first_event + m_header.n_events)) {
+        throw std::out_of_range("Event " + std::to_string(event) +
+                                " is not part of the event container file");
+    }
+    details::event_container_entry& result =
+        m_index[(event - m_header.first_event) * details::n_event_data_types +
+                static_cast<std::size_t>(type)];
+    if (result.offset != 0u) {
+        throw std::logic_error("Data written twice for event " +
+                               std::to_string(event));
+    }
+
+    // Pad the file up to the next aligned position.
+    static constexpr std::array<char, details::mapped_soa_alignment>
+        padding{};
+    const auto position = static_cast<std::uint64_t>(m_file.tellp());
+    result.offset = align(position);
+    m_file.write(padding.data(),
+                 static_cast<std::streamsize>(result.offset - position));
+    return result;
+}
+
+void event_container_writer::write(
+    std::size_t event, edm::silicon_cell_collection::const_view cells) {
+
+    details::event_container_entry& e =
+        start_entry(event, event_data_type::cells);
+    e.size = details::write_mapped_soa(
+        m_file, edm::silicon_cell_collection::const_device{cells});
+}
+
+void event_container_writer::write(
+    std::size_t event, edm::measurement_collection::const_view measurements) {
+
+    details::event_container_entry& e =
+        start_entry(event, event_data_type::measurements);
+    e.size = details::write_mapped_soa(
+        m_file, edm::measurement_collection::const_device{measurements});
+}
+
+void event_container_writer::write(
+    std::size_t event, edm::spacepoint_collection::const_view spacepoints) {
+
+    details::event_container_entry& e =
+        start_entry(event, event_data_type::spacepoints);
+    e.size = details::write_mapped_soa(
+        m_file, edm::spacepoint_collection::const_device{spacepoints});
+}
+
+void event_container_writer::write(
+    std::size_t event, const particle_collection_types::host& particles) {
+
+    static_assert(std::is_trivially_copyable_v<particle>,
+                  "Particle type can not be written as a plain array.");
+    details::event_container_entry& e =
+        start_entry(event, event_data_type::particles);
+    e.size = particles.size() * sizeof(particle);
+    m_file.write(reinterpret_cast<const char*>(particles.data()),
+                 static_cast<std::streamsize>(e.size));
+}
+
+void event_container_writer::close() {
+
+    if (!m_file.is_open()) {
+        return;
+    }
+
+    // Write the header and the index at the start of the file.
+    m_file.seekp(0);
+    m_file.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+    m_file.write(reinterpret_cast<const char*>(m_index.data()),
+                 static_cast<std::streamsize>(
+                     m_index.size() * sizeof(details::event_container_entry)));
+    m_file.close();
+    if (m_file.fail()) {
+        throw std::runtime_error("Failed to write event container file");
+    }
+}
+
+}  // namespace traccc::io
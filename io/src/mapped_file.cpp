@@ -0,0 +1,92 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/mapped_file.hpp"
+
+// System include(s).
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// POSIX include(s).
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace traccc::io {
+
+mapped_file::mapped_file(std::string_view filename) {
+
+    // Open the file.
+    const std::string name{filename};
+    const int fd = open(name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not open file: " + name);
+    }
+
+    // Map all of it into memory. An empty file does not need a mapping.
+    struct stat info{};
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        throw std::runtime_error("Could not access file: " + name);
+    }
+    m_size = static_cast<std::size_t>(info.st_size);
+    if (m_size > 0) {
+        m_data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (m_data == MAP_FAILED) {
+        m_data = nullptr;
+        m_size = 0;
+        throw std::runtime_error("Could not map file: " + name);
+    }
+}
+
+mapped_file::mapped_file(mapped_file&& parent) noexcept
+    : m_data(std::exchange(parent.m_data, nullptr)),
+      m_size(std::exchange(parent.m_size, 0)) {}
+
+mapped_file::~mapped_file() {
+
+    if (m_data != nullptr) {
+        munmap(m_data, m_size);
+    }
+}
+
+mapped_file& mapped_file::operator=(mapped_file&& rhs) noexcept {
+
+    if (this != &rhs) {
+        if (m_data != nullptr) {
+            munmap(m_data, m_size);
+        }
+        m_data = std::exchange(rhs.m_data, nullptr);
+        m_size = std::exchange(rhs.m_size, 0);
+    }
+    return *this;
+}
+
+const std::byte* mapped_file::data() const {
+
+    return static_cast<const std::byte*>(m_data);
+}
+
+std::size_t mapped_file::size() const {
+
+    return m_size;
+}
+
+mapped_file_buffer::mapped_file_buffer(const mapped_file& file) {
+
+    // The get area is never written to, the cast only satisfies the
+    // std::streambuf interface.
+    char* begin = const_cast<char*>(reinterpret_cast<const char*>(file.data()));
+    setg(begin, begin, begin + file.size());
+}
+
+}  // namespace traccc::io
@@ -0,0 +1,97 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/io/serial_reading.hpp"
+
+// TBB include(s).
+#if defined(TRACCC_HAVE_TBB)
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
+// System include(s).
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+namespace traccc::io::details {
+
+/// The maximum number of chunks to split the processing of a file into
+///
+/// It is the concurrency of the calling thread's TBB task arena, so that
+/// files read from inside of a TBB task would not oversubscribe the CPU. With
+/// @c traccc::io::serial_reading active it is 1, without TBB being queried.
+///
+inline std::size_t max_parallel_chunks() {
+
+#if defined(TRACCC_HAVE_TBB)
+    if (is_serial_reading()) {
+        return 1u;
+    }
+    return static_cast<std::size_t>(tbb::this_task_arena::max_concurrency());
+#else
+    return 1u;
+#endif
+}
+
+/// Process all chunks of a file in parallel
+///
+/// The chunks are processed with TBB, if it is available. The tasks are
+/// isolated, so that the waiting thread could not pick up unrelated work in
+/// the meantime. A single chunk, or any number of chunks with
+/// @c traccc::io::serial_reading active, are processed in the calling thread
+/// without using TBB. Exceptions thrown while processing any of the chunks are
+/// re-thrown after all of the chunks were processed.
+///
+/// @param n_chunks The number of chunks to process
+/// @param func     Function processing one chunk, receiving its index
+///
+template <typename FUNCTION>
+void for_each_chunk(std::size_t n_chunks, const FUNCTION& func) {
+
+    std::vector<std::exception_ptr> errors(n_chunks);
+    auto process = [&](std::size_t i) {
+        try {
+            func(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+#if defined(TRACCC_HAVE_TBB)
+    if ((n_chunks > 1u) && !is_serial_reading()) {
+        tbb::this_task_arena::isolate([&]() {
+            tbb::parallel_for(
+                tbb::blocked_range<std::size_t>{0u, n_chunks, 1u},
+                [&](const tbb::blocked_range<std::size_t>& range) {
+                    for (std::size_t i = range.begin(); i != range.end();
+                         ++i) {
+                        process(i);
+                    }
+                });
+        });
+    } else {
+        for (std::size_t i = 0; i < n_chunks; ++i) {
+            process(i);
+        }
+    }
+#else
+    for (std::size_t i = 0; i < n_chunks; ++i) {
+        process(i);
+    }
+#endif
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}  // namespace traccc::io::details
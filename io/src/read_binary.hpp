@@ -1,14 +1,18 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 #pragma once
 
+// Project include(s).
+#include "traccc/io/mapped_collection.hpp"
+
 // VecMem include(s).
 #include <ios>
+#include <vecmem/containers/data/vector_view.hpp>
 #include <vecmem/edm/host.hpp>
 #include <vecmem/memory/memory_resource.hpp>
 
@@ -17,6 +21,7 @@
 #include <fstream>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace traccc::io::details {
@@ -195,4 +200,59 @@ void read_binary_soa(
     read_binary_soa_impl<0>(result, in_file);
 }
 
+/// Implementation detail for @c traccc::io::details::copy_mapped_soa
+template <typename TYPE>
+void copy_mapped_soa_variable(const TYPE* from, std::remove_const_t<TYPE>& to) {
+
+    to = *from;
+}
+
+/// Implementation detail for @c traccc::io::details::copy_mapped_soa
+template <typename TYPE, typename ALLOC>
+void copy_mapped_soa_variable(
+    const vecmem::data::vector_view<const TYPE>& from,
+    std::vector<TYPE, ALLOC>& to) {
+
+    to.assign(from.ptr(), from.ptr() + from.capacity());
+}
+
+/// Function copying a (mapped) SoA container into a host container
+///
+/// @param view   The view of the mapped container
+/// @param result The container to fill
+///
+template <typename... CONST_VARTYPES, typename... VARTYPES,
+          template <typename> class INTERFACE>
+void copy_mapped_soa(
+    const vecmem::edm::view<vecmem::edm::schema<CONST_VARTYPES...>>& view,
+    vecmem::edm::host<vecmem::edm::schema<VARTYPES...>, INTERFACE>& result) {
+
+    [&]<std::size_t... INDICES>(std::index_sequence<INDICES...>) {
+        (copy_mapped_soa_variable(view.template get<INDICES>(),
+                                  result.template get<INDICES>()),
+         ...);
+    }(std::index_sequence_for<VARTYPES...>{});
+}
+
+/// Function reading an SoA container from a memory mappable binary file
+///
+/// The file is mapped into memory, and its variables are copied into the
+/// result container in one go each.
+///
+/// @tparam COLLECTION The collection type of the result container
+///
+/// @param result   The container to fill
+/// @param filename The full input filename
+///
+template <typename COLLECTION, typename... VARTYPES,
+          template <typename> class INTERFACE>
+void read_mapped_soa(
+    vecmem::edm::host<vecmem::edm::schema<VARTYPES...>, INTERFACE>& result,
+    std::string_view filename) {
+
+    // Map the file into memory, and copy all variables.
+    const mapped_collection<COLLECTION> mapped{filename};
+    copy_mapped_soa(mapped.view(), result);
+}
+
 }  // namespace traccc::io::details
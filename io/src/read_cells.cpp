@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2024 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,8 +8,10 @@
 // Local include(s).
 #include "traccc/io/read_cells.hpp"
 
+#include "compressed/compressed_soa.hpp"
 #include "csv/read_cells.hpp"
 #include "read_binary.hpp"
+#include "traccc/io/event_container.hpp"
 #include "traccc/io/utils.hpp"
 
 // System include(s).
@@ -46,6 +48,32 @@ void read_cells(edm::silicon_cell_collection::host& cells, std::size_t event,
                 ilogger->clone(), det_cond, format, deduplicate);
             break;
 
+        case data_format::mapped:
+            read_cells(
+                cells,
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(
+                                       get_event_filename(event, "-cells.soa")))
+                                      .native()),
+                ilogger->clone(), det_cond, format, deduplicate);
+            break;
+
+        case data_format::compressed:
+            read_cells(cells,
+                       get_absolute_path(
+                           (std::filesystem::path(directory) /
+                            std::filesystem::path(
+                                get_event_filename(event, "-cells.zdat")))
+                               .native()),
+                       ilogger->clone(), det_cond, format, deduplicate);
+            break;
+
+        case data_format::container:
+            event_container_reader::open(
+                get_event_container_filename(directory))
+                ->read_cells(cells, event);
+            break;
+
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -68,9 +96,27 @@ void read_cells(edm::silicon_cell_collection::host& cells,
             details::read_binary_soa(cells, filename);
             break;
 
+        case data_format::mapped:
+            details::read_mapped_soa<edm::silicon_cell_collection>(cells,
+                                                                   filename);
+            break;
+
+        case data_format::compressed:
+            details::read_compressed_soa(cells, filename);
+            break;
+
         default:
             throw std::invalid_argument("Unsupported data format");
     }
 }
 
+mapped_collection<edm::silicon_cell_collection> map_cells(
+    std::size_t event, std::string_view directory) {
+
+    return mapped_collection<edm::silicon_cell_collection>{get_absolute_path(
+        (std::filesystem::path(directory) /
+         std::filesystem::path(get_event_filename(event, "-cells.soa")))
+            .native())};
+}
+
 }  // namespace traccc::io
@@ -11,13 +11,105 @@
 #include "traccc/geometry/detector.hpp"
 #include "traccc/geometry/host_detector.hpp"
 #include "traccc/io/detector.hpp"
+#include "traccc/io/mapped_file.hpp"
 #include "traccc/io/utils.hpp"
 
 // System include(s).
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace {
 
+/// Extract the name of the detector from the header of a geometry file
+///
+/// This looks for the @c "detector" entry of the file's @c "header" object
+/// directly in the (memory mapped) text of the file. Which is a lot cheaper
+/// than parsing the whole file as JSON just to access its header, before
+/// it gets parsed again for the construction of the detector.
+///
+/// Only the direct members of the header object are looked at. Anything
+/// unexpected, including a file that can not be opened, makes the function
+/// give up, leaving it to the JSON parser to deal with the file.
+///
+/// @param filename The name of the geometry file
+/// @return The name of the detector, if it could be found
+///
+std::optional<std::string> peek_detector_name(const std::string& filename) {
+
+    // Map the file into memory. Leaving the reporting of a missing or
+    // unreadable file to detray.
+    std::optional<traccc::io::mapped_file> file;
+    try {
+        file.emplace(filename);
+    } catch (const std::runtime_error&) {
+        return std::nullopt;
+    }
+    const std::string_view text{reinterpret_cast<const char*>(file->data()),
+                                file->size()};
+    static constexpr std::string_view whitespace = " \t\r\n";
+
+    // Find the opening brace of the header object.
+    static constexpr std::string_view header_key = "\"header\"";
+    std::size_t pos = text.find(header_key);
+    if (pos == std::string_view::npos) {
+        return std::nullopt;
+    }
+    pos = text.find_first_not_of(whitespace, pos + header_key.size());
+    if ((pos == std::string_view::npos) || (text[pos] != ':')) {
+        return std::nullopt;
+    }
+    pos = text.find_first_not_of(whitespace, pos + 1);
+    if ((pos == std::string_view::npos) || (text[pos] != '{')) {
+        return std::nullopt;
+    }
+
+    // Walk through the header object, matching its braces and brackets, and
+    // look for a "detector" key among its direct members.
+    unsigned int depth = 0u;
+    for (; pos < text.size(); ++pos) {
+        const char c = text[pos];
+        if ((c == '{') || (c == '[')) {
+            ++depth;
+        } else if ((c == '}') || (c == ']')) {
+            if (--depth == 0u) {
+                // The end of the header object.
+                return std::nullopt;
+            }
+        } else if (c == '"') {
+            const std::size_t end = text.find_first_of("\"\\", pos + 1);
+            if ((end == std::string_view::npos) || (text[end] != '"')) {
+                // Leave escaped strings to the JSON parser.
+                return std::nullopt;
+            }
+            const std::string_view str = text.substr(pos + 1, end - pos - 1);
+            pos = end;
+            if ((depth != 1u) || (str != "detector")) {
+                continue;
+            }
+
+            // Read the (string) value of the entry, if this was a key.
+            std::size_t value = text.find_first_not_of(whitespace, end + 1);
+            if ((value == std::string_view::npos) || (text[value] != ':')) {
+                continue;
+            }
+            value = text.find_first_not_of(whitespace, value + 1);
+            if ((value == std::string_view::npos) || (text[value] != '"')) {
+                return std::nullopt;
+            }
+            const std::size_t value_end =
+                text.find_first_of("\"\\", value + 1);
+            if ((value_end == std::string_view::npos) ||
+                (text[value_end] != '"')) {
+                return std::nullopt;
+            }
+            return std::string{text.substr(value + 1, value_end - value - 1)};
+        }
+    }
+    return std::nullopt;
+}
+
 /// Common implementation for constructing a detector from a set of input files
 template <typename detector_t>
 void read_detector(traccc::host_detector& detector, vecmem::memory_resource& mr,
@@ -52,15 +144,22 @@ void read_detector(host_detector& detector, vecmem::memory_resource& mr,
                    const std::string_view& material_file,
                    const std::string_view& grid_file) {
 
-    // Peek at the header to determine the kind of detector that is needed
-    const auto header = detray::io::detail::deserialize_json_header(
-        traccc::io::get_absolute_path(geometry_file));
+    // Peek at the header to determine the kind of detector that is needed.
+    // Only parsing the file as JSON if its header could not be found with a
+    // simple text search. (Which is also how a missing file gets reported.)
+    const std::string geometry_path = get_absolute_path(geometry_file);
+    std::optional<std::string> detector_name =
+        peek_detector_name(geometry_path);
+    if (!detector_name) {
+        detector_name =
+            detray::io::detail::deserialize_json_header(geometry_path).detector;
+    }
 
     // TODO: Update this
-    if (header.detector == "Cylindrical detector from DD4hep blueprint") {
+    if (*detector_name == "Cylindrical detector from DD4hep blueprint") {
         ::read_detector<odd_detector>(detector, mr, geometry_file,
                                       material_file, grid_file);
-    } else if (header.detector == "detray_detector") {
+    } else if (*detector_name == "detray_detector") {
         ::read_detector<itk_detector>(detector, mr, geometry_file,
                                       material_file, grid_file);
     } else {
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2024 CERN for the benefit of the ACTS project
+ * (c) 2024-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 // Library include(s).
 #include "traccc/io/read_detector_description.hpp"
 
+#include "binary_detector_description.hpp"
 #include "traccc/geometry/host_detector.hpp"
 #include "traccc/io/detector.hpp"
 #include "traccc/io/read_conditions_config.hpp"
@@ -164,16 +165,22 @@ void read_detector_description(detector_design_description::host& det_desc,
                                const data_format digitization_format,
                                const data_format conditions_format) {
 
-    // Read the digitization configuration.
-    const digitization_config digi =
-        read_digitization_config(digitization_file, digitization_format);
-    const conditions_config cond =
-        read_conditions_config(conditions_file, conditions_format);
     // Fill the detector description with the correct type of geometry file.
     switch (geometry_format) {
-        case data_format::json:
+        case data_format::json: {
+            // Read the digitization and conditions configurations.
+            const digitization_config digi = read_digitization_config(
+                digitization_file, digitization_format);
+            const conditions_config cond =
+                read_conditions_config(conditions_file, conditions_format);
             ::read_json_dd(det_desc, det_cond, geometry_file, digi, cond);
             break;
+        }
+        case data_format::binary:
+            // The binary file holds the complete description.
+            details::read_binary_detector_description(
+                det_desc, det_cond, get_absolute_path(geometry_file));
+            break;
         default:
             throw std::invalid_argument("Unsupported geometry format.");
     }
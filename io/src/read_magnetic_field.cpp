@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2025 CERN for the benefit of the ACTS project
+ * (c) 2025-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 // Local include(s).
 #include "traccc/io/read_magnetic_field.hpp"
 
+#include "traccc/io/mapped_file.hpp"
 #include "traccc/io/utils.hpp"
 
 // Project include(s).
@@ -15,10 +16,31 @@
 
 // System include(s).
 #include <format>
-#include <fstream>
+#include <istream>
 #include <stdexcept>
 
 namespace traccc::io {
+namespace {
+
+/// Map a magnetic field file into memory
+///
+/// @param filename The name of the field file
+/// @return The mapped file
+///
+/// @throw std::invalid_argument If the file could not be opened
+///
+mapped_file map_field_file(std::string_view filename) {
+
+    try {
+        return mapped_file{get_absolute_path(filename)};
+    } catch (const std::runtime_error&) {
+        throw std::invalid_argument(
+            std::format("Failed to open magnetic field file: {}", filename));
+    }
+}
+
+}  // namespace
+
 namespace binary {
 
 void read_magnetic_field(magnetic_field& bfield, std::string_view filename,
@@ -27,13 +49,12 @@ void read_magnetic_field(magnetic_field& bfield, std::string_view filename,
     // Set up a local logger.
     TRACCC_LOCAL_LOGGER(std::move(ilogger));
 
-    // Open the file.
-    std::ifstream ifile{get_absolute_path(filename),
-                        std::ios::binary | std::ios::in};
-    if (!ifile.is_open()) {
-        throw std::invalid_argument(
-            std::format("Failed to open magnetic field file: {}", filename));
-    }
+    // Map the file into memory. Its pages are only read from the disk as
+    // covfie reaches them, and they stay in the page cache for any other
+    // process reading the same field.
+    const mapped_file file = map_field_file(filename);
+    mapped_file_buffer buffer{file};
+    std::istream ifile{&buffer};
 
     // Construct/fill the magnetic field from the file.
     TRACCC_INFO("Reading magnetic field from file: " << filename);
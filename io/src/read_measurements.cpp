@@ -8,8 +8,10 @@
 // Local include(s).
 #include "traccc/io/read_measurements.hpp"
 
+#include "compressed/compressed_soa.hpp"
 #include "csv/read_measurements.hpp"
 #include "read_binary.hpp"
+#include "traccc/io/event_container.hpp"
 #include "traccc/io/utils.hpp"
 
 // System include(s).
@@ -43,6 +45,30 @@ std::vector<measurement_id_type> read_measurements(
                                       .native()),
                 detector, det_desc, det_cond, sort_measurements, format);
         }
+        case data_format::mapped: {
+            return read_measurements(
+                measurements,
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.soa")))
+                                      .native()),
+                detector, det_desc, det_cond, sort_measurements, format);
+        }
+        case data_format::compressed: {
+            return read_measurements(
+                measurements,
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.zdat")))
+                                      .native()),
+                detector, det_desc, det_cond, sort_measurements, format);
+        }
+        case data_format::container: {
+            event_container_reader::open(
+                get_event_container_filename(directory))
+                ->read_measurements(measurements, event);
+            return {};
+        }
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -63,9 +89,25 @@ std::vector<measurement_id_type> read_measurements(
         case data_format::binary:
             details::read_binary_soa(measurements, filename);
             return {};
+        case data_format::mapped:
+            details::read_mapped_soa<edm::measurement_collection>(
+                measurements, filename);
+            return {};
+        case data_format::compressed:
+            details::read_compressed_soa(measurements, filename);
+            return {};
         default:
             throw std::invalid_argument("Unsupported data format");
     }
 }
 
+mapped_collection<edm::measurement_collection> map_measurements(
+    std::size_t event, std::string_view directory) {
+
+    return mapped_collection<edm::measurement_collection>{get_absolute_path(
+        (std::filesystem::path(directory) /
+         std::filesystem::path(get_event_filename(event, "-measurements.soa")))
+            .native())};
+}
+
 }  // namespace traccc::io
@@ -9,6 +9,7 @@
 #include "traccc/io/read_particles.hpp"
 
 #include "csv/read_particles.hpp"
+#include "traccc/io/event_container.hpp"
 #include "traccc/io/utils.hpp"
 
 // System include(s).
@@ -31,6 +32,11 @@ void read_particles(particle_collection_types::host& particles,
                         .native()),
                 format);
             break;
+        case data_format::container:
+            event_container_reader::open(
+                get_event_container_filename(directory))
+                ->read_particles(particles, event);
+            break;
         default:
             throw std::invalid_argument("Unsupported data format");
     }
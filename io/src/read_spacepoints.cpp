@@ -8,8 +8,10 @@
 // Local include(s).
 #include "traccc/io/read_spacepoints.hpp"
 
+#include "compressed/compressed_soa.hpp"
 #include "csv/read_spacepoints.hpp"
 #include "read_binary.hpp"
+#include "traccc/io/event_container.hpp"
 #include "traccc/io/utils.hpp"
 
 // System include(s).
@@ -58,6 +60,40 @@ void read_spacepoints(
                 "", detector, det_desc, det_cond, format);
             break;
         }
+        case data_format::mapped: {
+            read_spacepoints(
+                spacepoints, measurements,
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(
+                                       get_event_filename(event, "-hits.soa")))
+                                      .native()),
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.soa")))
+                                      .native()),
+                "", detector, det_desc, det_cond, format);
+            break;
+        }
+        case data_format::compressed: {
+            read_spacepoints(
+                spacepoints, measurements,
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(
+                                       get_event_filename(event, "-hits.zdat")))
+                                      .native()),
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.zdat")))
+                                      .native()),
+                "", detector, det_desc, det_cond, format);
+            break;
+        }
+        case data_format::container: {
+            event_container_reader::open(
+                get_event_container_filename(directory))
+                ->read_spacepoints(spacepoints, measurements, event);
+            break;
+        }
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -83,6 +119,16 @@ void read_spacepoints(
             details::read_binary_soa(spacepoints, hit_filename);
             details::read_binary_soa(measurements, meas_filename);
             break;
+        case data_format::mapped:
+            details::read_mapped_soa<edm::spacepoint_collection>(spacepoints,
+                                                                 hit_filename);
+            details::read_mapped_soa<edm::measurement_collection>(
+                measurements, meas_filename);
+            break;
+        case data_format::compressed:
+            details::read_compressed_soa(spacepoints, hit_filename);
+            details::read_compressed_soa(measurements, meas_filename);
+            break;
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -0,0 +1,34 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Local include(s).
+#include "traccc/io/serial_reading.hpp"
+
+namespace traccc::io {
+namespace {
+
+/// Whether files have to be read serially in the current thread
+thread_local bool serial_reading_enabled = false;
+
+}  // namespace
+
+bool is_serial_reading() {
+
+    return serial_reading_enabled;
+}
+
+serial_reading::serial_reading() : m_previous(serial_reading_enabled) {
+
+    serial_reading_enabled = true;
+}
+
+serial_reading::~serial_reading() {
+
+    serial_reading_enabled = m_previous;
+}
+
+}  // namespace traccc::io
@@ -8,6 +8,8 @@
 // Local include(s).
 #include "traccc/io/write.hpp"
 
+#include "binary_detector_description.hpp"
+#include "compressed/compressed_soa.hpp"
 #include "csv/write_cells.hpp"
 #include "json/write_digitization_config.hpp"
 #include "obj/write_seeds.hpp"
@@ -39,6 +41,23 @@ void write(std::size_t event, std::string_view directory,
                                       .native()),
                 traccc::edm::silicon_cell_collection::const_device{cells});
             break;
+        case data_format::mapped:
+            details::write_mapped_soa(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(
+                                       get_event_filename(event, "-cells.soa")))
+                                      .native()),
+                traccc::edm::silicon_cell_collection::const_device{cells});
+            break;
+        case data_format::compressed:
+            details::write_compressed_soa(
+                get_absolute_path(
+                    (std::filesystem::path(directory) /
+                     std::filesystem::path(
+                         get_event_filename(event, "-cells.zdat")))
+                        .native()),
+                traccc::edm::silicon_cell_collection::const_device{cells});
+            break;
         case data_format::csv:
             csv::write_cells(
                 get_absolute_path((std::filesystem::path(directory) /
@@ -72,6 +91,34 @@ void write(std::size_t event, std::string_view directory,
                                       .native()),
                 edm::measurement_collection::const_device{measurements});
             break;
+        case data_format::mapped:
+            details::write_mapped_soa(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(
+                                       get_event_filename(event, "-hits.soa")))
+                                      .native()),
+                edm::spacepoint_collection::const_device{spacepoints});
+            details::write_mapped_soa(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.soa")))
+                                      .native()),
+                edm::measurement_collection::const_device{measurements});
+            break;
+        case data_format::compressed:
+            details::write_compressed_soa(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(
+                                       get_event_filename(event, "-hits.zdat")))
+                                      .native()),
+                edm::spacepoint_collection::const_device{spacepoints});
+            details::write_compressed_soa(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.zdat")))
+                                      .native()),
+                edm::measurement_collection::const_device{measurements});
+            break;
         case data_format::obj:
             obj::write_spacepoints(
                 get_absolute_path((std::filesystem::path(directory) /
@@ -98,6 +145,22 @@ void write(std::size_t event, std::string_view directory,
                                       .native()),
                 edm::measurement_collection::const_device{measurements});
             break;
+        case data_format::mapped:
+            details::write_mapped_soa(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.soa")))
+                                      .native()),
+                edm::measurement_collection::const_device{measurements});
+            break;
+        case data_format::compressed:
+            details::write_compressed_soa(
+                get_absolute_path((std::filesystem::path(directory) /
+                                   std::filesystem::path(get_event_filename(
+                                       event, "-measurements.zdat")))
+                                      .native()),
+                edm::measurement_collection::const_device{measurements});
+            break;
         default:
             throw std::invalid_argument("Unsupported data format");
     }
@@ -140,6 +203,20 @@ void write(std::size_t event, std::string_view directory,
     }
 }
 
+void write(std::string_view filename, data_format format,
+           detector_design_description::const_view det_desc,
+           detector_conditions_description::const_view det_cond) {
+
+    switch (format) {
+        case data_format::binary:
+            details::write_binary_detector_description(
+                get_absolute_path(filename), det_desc, det_cond);
+            break;
+        default:
+            throw std::invalid_argument("Unsupported data format");
+    }
+}
+
 void write(std::string_view filename, data_format format,
            const digitization_config& config) {
 
@@ -1,16 +1,22 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 #pragma once
 
+// Project include(s).
+#include "traccc/io/details/mapped_soa.hpp"
+
 // System include(s).
+#include <array>
+#include <cstdint>
 #include <fstream>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace traccc::io::details {
@@ -182,4 +188,111 @@ void write_binary_soa(
     write_binary_soa_impl<0>(container, out_file);
 }
 
+/// Implementation detail for @c traccc::io::details::write_mapped_soa
+template <typename TYPE>
+mapped_soa_column mapped_soa_variable(const TYPE& var, const char*& payload) {
+
+    // Make sure that the type works.
+    static_assert(std::is_standard_layout_v<TYPE>,
+                  "Scalar type does not have a standard layout.");
+
+    // Describe the scalar variable.
+    payload = reinterpret_cast<const char*>(&var);
+    return {0u, sizeof(TYPE), 1u};
+}
+
+/// Implementation detail for @c traccc::io::details::write_mapped_soa
+template <typename TYPE>
+mapped_soa_column mapped_soa_variable(const vecmem::device_vector<TYPE>& var,
+                                      const char*& payload) {
+
+    // Make sure that the type works.
+    static_assert(std::is_standard_layout_v<TYPE>,
+                  "Vector type does not have a standard layout.");
+
+    // Describe the vector variable.
+    payload = reinterpret_cast<const char*>(var.data());
+    return {0u, sizeof(TYPE), var.size()};
+}
+
+/// Jagged vectors can not be written in the memory mappable format
+template <typename TYPE>
+mapped_soa_column mapped_soa_variable(
+    const vecmem::jagged_device_vector<TYPE>& var,
+    const char*& payload) = delete;
+
+/// Function writing the memory mappable image of an SoA container
+///
+/// The offsets in the image are relative to the beginning of the image. So
+/// the image must be written at a position aligned to
+/// @c mapped_soa_alignment, for its payloads to end up aligned.
+///
+/// @param out_file The stream to write the image into
+/// @param container The container to write
+/// @return The size of the written image
+///
+template <typename... VARTYPES, template <typename> class INTERFACE>
+std::uint64_t write_mapped_soa(
+    std::ostream& out_file,
+    const vecmem::edm::device<vecmem::edm::schema<VARTYPES...>, INTERFACE>&
+        container) {
+
+    // Describe all variables.
+    static constexpr std::size_t N_VARIABLES = sizeof...(VARTYPES);
+    std::array<mapped_soa_column, N_VARIABLES> columns;
+    std::array<const char*, N_VARIABLES> payloads;
+    [&]<std::size_t... INDICES>(std::index_sequence<INDICES...>) {
+        ((columns[INDICES] = mapped_soa_variable(
+              container.template get<INDICES>(), payloads[INDICES])),
+         ...);
+    }(std::index_sequence_for<VARTYPES...>{});
+
+    // Set up the header, and place all payloads at aligned offsets.
+    mapped_soa_header header;
+    header.n_variables = N_VARIABLES;
+    header.size = container.size();
+    std::uint64_t offset = sizeof(header) + sizeof(columns);
+    for (mapped_soa_column& column : columns) {
+        offset = (offset + mapped_soa_alignment - 1) / mapped_soa_alignment *
+                 mapped_soa_alignment;
+        column.offset = offset;
+        offset += column.count * column.element_size;
+    }
+
+    // Write the header and the variable descriptions.
+    out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out_file.write(reinterpret_cast<const char*>(columns.data()),
+                   sizeof(columns));
+
+    // Write the payloads, with the necessary padding before them.
+    static constexpr std::array<char, mapped_soa_alignment> padding{};
+    std::uint64_t position = sizeof(header) + sizeof(columns);
+    for (std::size_t i = 0; i < N_VARIABLES; ++i) {
+        out_file.write(padding.data(), static_cast<std::streamsize>(
+                                           columns[i].offset - position));
+        const std::uint64_t size = columns[i].count * columns[i].element_size;
+        out_file.write(payloads[i], static_cast<std::streamsize>(size));
+        position = columns[i].offset + size;
+    }
+    return position;
+}
+
+/// Function writing an SoA container into a memory mappable binary file
+///
+/// @param filename The full output filename
+/// @param container The container to write
+///
+template <typename... VARTYPES, template <typename> class INTERFACE>
+void write_mapped_soa(
+    std::string_view filename,
+    const vecmem::edm::device<vecmem::edm::schema<VARTYPES...>, INTERFACE>&
+        container) {
+
+    // Open the output file.
+    std::ofstream out_file(filename.data(), std::ios::binary);
+
+    // Write the container's image into it.
+    write_mapped_soa(out_file, container);
+}
+
 }  // namespace traccc::io::details
@@ -0,0 +1,93 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// System include(s).
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+
+namespace traccc::performance {
+
+/// Hardware performance counter values
+struct hardware_counts {
+
+    /// The number of (user space) CPU cycles
+    std::uint64_t cycles = 0;
+    /// The number of retired instructions
+    std::uint64_t instructions = 0;
+    /// The number of last level cache misses
+    std::uint64_t cache_misses = 0;
+    /// The number of mispredicted branches
+    std::uint64_t branch_misses = 0;
+
+    /// Add the values of another measurement to this one
+    hardware_counts& operator+=(const hardware_counts& other);
+    /// Get the difference of two measurements
+    hardware_counts operator-(const hardware_counts& other) const;
+
+    /// Instructions per cycle
+    double ipc() const;
+    /// Cache misses per thousand instructions
+    double cache_mpki() const;
+    /// Branch misses per thousand instructions
+    double branch_mpki() const;
+
+};  // struct hardware_counts
+
+/// Hardware performance counters of the calling thread
+///
+/// Uses @c perf_event_open(2) on Linux, to count the events of the calling
+/// thread (in user space) since the first time that it accessed its
+/// counters. The counting is switched off by default, and has to be enabled
+/// explicitly with @c traccc::performance::hardware_counters::enable. Once
+/// enabled, @c traccc::performance::timer also collects the counter values
+/// of its scope.
+///
+/// Note that the counters only see the work done by the thread that created
+/// the timer, not by any tasks that it may have handed to other threads.
+///
+class hardware_counters {
+
+    public:
+    /// Enable or disable the counting, for all threads
+    ///
+    /// @param value Whether the counting should be enabled
+    /// @return @c true if the counters are available on this host, @c false
+    ///         if they are not (in which case the counting stays disabled)
+    ///
+    static bool enable(bool value = true);
+    /// Check whether the counting is enabled
+    static bool enabled();
+
+    /// Get the counters of the calling thread
+    ///
+    /// @return A pointer to the counters of the calling thread, or a null
+    ///         pointer if the counting is disabled or unavailable
+    ///
+    static const hardware_counters* this_thread();
+
+    /// Read the current values of the counters
+    hardware_counts read() const;
+
+    /// Destructor, closing the counters
+    ~hardware_counters();
+
+    private:
+    /// Constructor, opening the counters of the calling thread
+    hardware_counters();
+
+    /// The file descriptors of the counters (-1 for unavailable ones)
+    std::array<int, 4> m_fds{-1, -1, -1, -1};
+
+};  // class hardware_counters
+
+/// Printout helper for @c traccc::performance::hardware_counts
+std::ostream& operator<<(std::ostream& out, const hardware_counts& counts);
+
+}  // namespace traccc::performance
@@ -0,0 +1,150 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "traccc/performance/timing_info.hpp"
+
+// System include(s).
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace traccc::performance {
+
+/// Summary of the latency distribution of one measured component
+struct latency_summary {
+
+    /// The name of the component
+    std::string name;
+    /// The number of measurements
+    std::size_t count = 0;
+
+    /// @name Statistics of the distribution
+    /// @{
+
+    std::chrono::nanoseconds mean{0};
+    std::chrono::nanoseconds min{0};
+    std::chrono::nanoseconds p50{0};
+    std::chrono::nanoseconds p90{0};
+    std::chrono::nanoseconds p99{0};
+    std::chrono::nanoseconds p999{0};
+    std::chrono::nanoseconds max{0};
+
+    /// @}
+
+    /// Histogram of the measurements, with logarithmic binning
+    ///
+    /// Bin @c i holds the number of measurements in the range
+    /// <tt>[2^i, 2^(i+1))</tt> microseconds. With bin 0 also holding all
+    /// measurements below 1 microsecond.
+    ///
+    std::vector<std::size_t> histogram;
+
+};  // struct latency_summary
+
+/// Storage for per-event latency measurements
+///
+/// The measurements are recorded into "slots", each of which must only be
+/// written to by a single thread at a time. (Typically by using one slot per
+/// thread.) This way the recording does not need any locking. Summaries must
+/// only be created once all threads finished recording.
+///
+class latency_info {
+
+    public:
+    /// Constructor with the number of slots to set up
+    ///
+    /// @param slots The number of independent slots to record into
+    ///
+    explicit latency_info(std::size_t slots = 1);
+
+    /// Record a single latency measurement
+    ///
+    /// @param slot    The slot to record the measurement into
+    /// @param name    The name of the measured component
+    /// @param latency The measured latency
+    ///
+    void record(std::size_t slot, std::string_view name,
+                std::chrono::nanoseconds latency);
+
+    /// Record all measurements of a single event
+    ///
+    /// Hardware counter values, if the timing information has any, are
+    /// summed up per component.
+    ///
+    /// @param slot  The slot to record the measurements into
+    /// @param times The timing information collected for the event
+    ///
+    void record(std::size_t slot, const timing_info& times);
+
+    /// Forget about all previously recorded measurements
+    void clear();
+
+    /// Get all recorded measurements, merged over all slots
+    ///
+    /// @return The measurements of all recorded components, in the order in
+    ///         which they were first recorded
+    ///
+    std::vector<std::pair<std::string, std::vector<std::chrono::nanoseconds>>>
+    samples() const;
+
+    /// Summarise the recorded measurements
+    ///
+    /// @return Summaries for all recorded components, in the order in which
+    ///         they were first recorded
+    ///
+    std::vector<latency_summary> summarize() const;
+
+    /// Get the hardware counter values summed over all recorded events
+    ///
+    /// @return The summed values of all components with hardware counter
+    ///         values, in the order in which they were first recorded
+    ///
+    std::vector<counter_info_pair> counters() const;
+
+    private:
+    /// Measurements of one slot
+    struct alignas(64) slot_data {
+        /// Latencies of the different components
+        std::vector<
+            std::pair<std::string, std::vector<std::chrono::nanoseconds>>>
+            m_latencies;
+        /// Summed hardware counter values of the different components
+        std::vector<counter_info_pair> m_counters;
+    };
+
+    /// The per-slot measurements
+    std::vector<slot_data> m_slots;
+
+};  // class latency_info
+
+/// Printout helper for @c traccc::performance::latency_summary
+std::ostream& operator<<(std::ostream& out, const latency_summary& summary);
+
+/// Write latency summaries in CSV format
+///
+/// @param out       The stream to write to
+/// @param summaries The summaries to write
+///
+void write_csv(std::ostream& out,
+               const std::vector<latency_summary>& summaries);
+
+/// Write latency summaries in JSON format
+///
+/// @param out       The stream to write to
+/// @param summaries The summaries to write
+///
+void write_json(std::ostream& out,
+                const std::vector<latency_summary>& summaries);
+
+}  // namespace traccc::performance
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s).
+#include "traccc/performance/hardware_counters.hpp"
 #include "traccc/performance/timing_info.hpp"
 
 // System include(s).
@@ -22,6 +23,9 @@ namespace traccc::performance {
 /// Creating more than one start & stop of timer with the same timer_name &
 /// sharing timing info will lead to incrementing the total time for that name
 ///
+/// If @c traccc::performance::hardware_counters are enabled, the hardware
+/// counter values of the calling thread are collected for the same scope.
+///
 class timer {
 
     public:
@@ -37,6 +41,11 @@ class timer {
     /// Start time (measured at construct time)
     std::chrono::high_resolution_clock::time_point m_start;
 
+    /// Hardware counters of the thread (if enabled)
+    const hardware_counters* m_counters;
+    /// Hardware counter values at the start of the measurement
+    hardware_counts m_start_counts;
+
     /// Name of measurement
     std::string m_name;
 
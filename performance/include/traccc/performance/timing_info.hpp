@@ -1,15 +1,19 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
 
 #pragma once
 
+// Local include(s).
+#include "traccc/performance/hardware_counters.hpp"
+
 // System include(s).
 #include <chrono>
 #include <iosfwd>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -18,6 +22,8 @@ namespace traccc::performance {
 
 /// Helper type used for timing information storage
 using timing_info_pair = std::pair<std::string, std::chrono::nanoseconds>;
+/// Helper type used for hardware counter information storage
+using counter_info_pair = std::pair<std::string, hardware_counts>;
 
 /// Struct for storing time measurements collected in timer class
 ///
@@ -25,6 +31,8 @@ struct timing_info {
 
     /// The low level data.
     std::vector<timing_info_pair> data;
+    /// Hardware counter values, for the components that had them collected
+    std::vector<counter_info_pair> counters;
 
     /// Get the time taken by a given component
     ///
@@ -33,6 +41,13 @@ struct timing_info {
     ///
     std::chrono::nanoseconds get_time(std::string_view timer_name) const;
 
+    /// Get the hardware counter values of a given component
+    ///
+    /// @param timer_name The name of the component
+    /// @return The hardware counter values collected for the component
+    ///
+    hardware_counts get_counts(std::string_view timer_name) const;
+
 };  // struct timing_info
 
 /// Printout helper for @c traccc::performance::timing_info
@@ -65,7 +65,7 @@ struct event_data {
     ///
     void fill_cca_result(
         const edm::silicon_cell_collection::host& cells,
-        const edm::silicon_cluster_collection::host& cca_clusters,
+        const edm::silicon_cluster_collection::const_view& cca_clusters,
         const edm::measurement_collection::host& cca_measurements,
         const detector_conditions_description::host& det_cond);
 
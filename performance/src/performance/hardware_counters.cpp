@@ -0,0 +1,171 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/hardware_counters.hpp"
+
+// System include(s).
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+
+// Linux include(s).
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // __linux__
+
+namespace traccc::performance {
+namespace {
+
+/// Flag for enabling/disabling the counting
+std::atomic_bool counting_enabled = false;
+
+/// Calculate a ratio, protecting against division by zero
+double ratio(std::uint64_t numerator, std::uint64_t denominator,
+             double scale = 1.) {
+
+    return (denominator == 0 ? 0.
+                             : scale * static_cast<double>(numerator) /
+                                   static_cast<double>(denominator));
+}
+
+#ifdef __linux__
+/// The hardware events to count, in the order of the @c m_fds array
+constexpr std::array<std::uint64_t, 4> hardware_events = {
+    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+#endif  // __linux__
+
+}  // namespace
+
+hardware_counts& hardware_counts::operator+=(const hardware_counts& other) {
+
+    cycles += other.cycles;
+    instructions += other.instructions;
+    cache_misses += other.cache_misses;
+    branch_misses += other.branch_misses;
+    return *this;
+}
+
+hardware_counts hardware_counts::operator-(const hardware_counts& other) const {
+
+    return {cycles - other.cycles, instructions - other.instructions,
+            cache_misses - other.cache_misses,
+            branch_misses - other.branch_misses};
+}
+
+double hardware_counts::ipc() const {
+
+    return ratio(instructions, cycles);
+}
+
+double hardware_counts::cache_mpki() const {
+
+    return ratio(cache_misses, instructions, 1000.);
+}
+
+double hardware_counts::branch_mpki() const {
+
+    return ratio(branch_misses, instructions, 1000.);
+}
+
+bool hardware_counters::enable(bool value) {
+
+    counting_enabled = value;
+    if (value && (this_thread() == nullptr)) {
+        counting_enabled = false;
+        return false;
+    }
+    return true;
+}
+
+bool hardware_counters::enabled() {
+
+    return counting_enabled;
+}
+
+const hardware_counters* hardware_counters::this_thread() {
+
+    if (!counting_enabled) {
+        return nullptr;
+    }
+    thread_local const hardware_counters counters;
+    return (counters.m_fds[0] >= 0 ? &counters : nullptr);
+}
+
+hardware_counters::hardware_counters() {
+
+#ifdef __linux__
+    // Open the counters as one group, led by the cycle counter. So that they
+    // would all be scheduled onto the PMU at the same time.
+    for (std::size_t i = 0; i < hardware_events.size(); ++i) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = hardware_events[i];
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        m_fds[i] = static_cast<int>(
+            syscall(SYS_perf_event_open, &attr, 0, -1, m_fds[0], 0));
+        // Without a group leader, there's nothing to measure.
+        if (m_fds[0] < 0) {
+            return;
+        }
+    }
+#endif  // __linux__
+}
+
+hardware_counters::~hardware_counters() {
+
+#ifdef __linux__
+    for (int fd : m_fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+#endif  // __linux__
+}
+
+hardware_counts hardware_counters::read() const {
+
+    hardware_counts result;
+#ifdef __linux__
+    // Read all counters of the group in one go. The values of the counters
+    // that could be opened come in the order in which they were opened.
+    std::array<std::uint64_t, 1 + hardware_events.size()> buffer{};
+    if (::read(m_fds[0], buffer.data(), sizeof(buffer)) <= 0) {
+        return result;
+    }
+    std::array<std::uint64_t, hardware_events.size()> values{};
+    for (std::size_t i = 0, value = 1; i < m_fds.size(); ++i) {
+        if ((m_fds[i] >= 0) && (value <= buffer[0])) {
+            values[i] = buffer[value++];
+        }
+    }
+    result = {values[0], values[1], values[2], values[3]};
+#endif  // __linux__
+    return result;
+}
+
+std::ostream& operator<<(std::ostream& out, const hardware_counts& counts) {
+
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(2) << "IPC: " << counts.ipc()
+        << ", cache MPKI: " << counts.cache_mpki()
+        << ", branch MPKI: " << counts.branch_mpki() << " ("
+        << counts.cycles << " cycles, " << counts.instructions
+        << " instructions)";
+    out.flags(flags);
+    out.precision(precision);
+    return out;
+}
+
+}  // namespace traccc::performance
@@ -0,0 +1,226 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Library include(s).
+#include "traccc/performance/latency_info.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+
+namespace traccc::performance {
+namespace {
+
+/// Get a given quantile of a sorted set of latencies (nearest-rank method)
+std::chrono::nanoseconds quantile(
+    const std::vector<std::chrono::nanoseconds>& sorted, double q) {
+
+    const double rank = std::ceil(q * static_cast<double>(sorted.size()));
+    const std::size_t index =
+        std::min(static_cast<std::size_t>(std::max(rank, 1.)), sorted.size());
+    return sorted[index - 1];
+}
+
+/// Add hardware counter values to a given component in a list
+void add_counts(std::vector<counter_info_pair>& counters,
+                const std::string& name, const hardware_counts& counts) {
+
+    auto pos = std::find_if(
+        counters.begin(), counters.end(),
+        [&name](const counter_info_pair& element) {
+            return element.first == name;
+        });
+    if (pos == counters.end()) {
+        counters.emplace_back(name, counts);
+    } else {
+        pos->second += counts;
+    }
+}
+
+/// Convert a latency into milliseconds, for printing
+double to_ms(std::chrono::nanoseconds latency) {
+
+    return std::chrono::duration<double, std::milli>(latency).count();
+}
+
+}  // namespace
+
+latency_info::latency_info(std::size_t slots) : m_slots(slots) {
+
+    if (slots == 0) {
+        throw std::invalid_argument("At least one slot is needed");
+    }
+}
+
+void latency_info::record(std::size_t slot, std::string_view name,
+                          std::chrono::nanoseconds latency) {
+
+    auto& latencies = m_slots.at(slot).m_latencies;
+    auto pos = std::find_if(
+        latencies.begin(), latencies.end(),
+        [&name](const auto& element) { return element.first == name; });
+    if (pos == latencies.end()) {
+        latencies.emplace_back(std::string{name},
+                               std::vector<std::chrono::nanoseconds>{});
+        pos = latencies.end() - 1;
+    }
+    pos->second.push_back(latency);
+}
+
+void latency_info::record(std::size_t slot, const timing_info& times) {
+
+    for (const timing_info_pair& element : times.data) {
+        record(slot, element.first, element.second);
+    }
+    for (const counter_info_pair& element : times.counters) {
+        add_counts(m_slots.at(slot).m_counters, element.first,
+                   element.second);
+    }
+}
+
+void latency_info::clear() {
+
+    for (slot_data& slot : m_slots) {
+        slot.m_latencies.clear();
+        slot.m_counters.clear();
+    }
+}
+
+std::vector<std::pair<std::string, std::vector<std::chrono::nanoseconds>>>
+latency_info::samples() const {
+
+    std::vector<std::pair<std::string, std::vector<std::chrono::nanoseconds>>>
+        merged;
+    for (const slot_data& slot : m_slots) {
+        for (const auto& [name, latencies] : slot.m_latencies) {
+            auto pos = std::find_if(
+                merged.begin(), merged.end(),
+                [&name](const auto& element) { return element.first == name; });
+            if (pos == merged.end()) {
+                merged.emplace_back(name, latencies);
+            } else {
+                pos->second.insert(pos->second.end(), latencies.begin(),
+                                   latencies.end());
+            }
+        }
+    }
+    return merged;
+}
+
+std::vector<latency_summary> latency_info::summarize() const {
+
+    // Collect the measurements of all slots.
+    std::vector<std::pair<std::string, std::vector<std::chrono::nanoseconds>>>
+        merged = samples();
+
+    // Summarise each component.
+    std::vector<latency_summary> result;
+    result.reserve(merged.size());
+    for (auto& [name, latencies] : merged) {
+
+        std::sort(latencies.begin(), latencies.end());
+
+        latency_summary summary;
+        summary.name = name;
+        summary.count = latencies.size();
+        summary.mean = std::accumulate(latencies.begin(), latencies.end(),
+                                       std::chrono::nanoseconds{0}) /
+                       static_cast<std::chrono::nanoseconds::rep>(
+                           latencies.size());
+        summary.min = latencies.front();
+        summary.p50 = quantile(latencies, 0.5);
+        summary.p90 = quantile(latencies, 0.9);
+        summary.p99 = quantile(latencies, 0.99);
+        summary.p999 = quantile(latencies, 0.999);
+        summary.max = latencies.back();
+
+        for (const std::chrono::nanoseconds latency : latencies) {
+            const auto us = static_cast<unsigned long long>(
+                std::chrono::duration_cast<std::chrono::microseconds>(latency)
+                    .count());
+            std::size_t bin = 0;
+            while ((us >> (bin + 1)) > 0) {
+                ++bin;
+            }
+            if (summary.histogram.size() <= bin) {
+                summary.histogram.resize(bin + 1, 0u);
+            }
+            ++(summary.histogram[bin]);
+        }
+
+        result.push_back(std::move(summary));
+    }
+    return result;
+}
+
+std::vector<counter_info_pair> latency_info::counters() const {
+
+    std::vector<counter_info_pair> result;
+    for (const slot_data& slot : m_slots) {
+        for (const counter_info_pair& element : slot.m_counters) {
+            add_counts(result, element.first, element.second);
+        }
+    }
+    return result;
+}
+
+std::ostream& operator<<(std::ostream& out, const latency_summary& summary) {
+
+    const std::ios_base::fmtflags flags = out.flags();
+    const std::streamsize precision = out.precision();
+    out << std::setw(30) << std::right << summary.name << "  " << std::fixed
+        << std::setprecision(3) << "mean: " << to_ms(summary.mean)
+        << " ms, p50: " << to_ms(summary.p50)
+        << " ms, p99: " << to_ms(summary.p99)
+        << " ms, p999: " << to_ms(summary.p999)
+        << " ms, max: " << to_ms(summary.max) << " ms (" << summary.count
+        << " events)";
+    out.flags(flags);
+    out.precision(precision);
+    return out;
+}
+
+void write_csv(std::ostream& out,
+               const std::vector<latency_summary>& summaries) {
+
+    out << "name,count,mean_ns,min_ns,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n";
+    for (const latency_summary& s : summaries) {
+        out << "\"" << s.name << "\"," << s.count << "," << s.mean.count()
+            << "," << s.min.count() << "," << s.p50.count() << ","
+            << s.p90.count() << "," << s.p99.count() << "," << s.p999.count()
+            << "," << s.max.count() << "\n";
+    }
+}
+
+void write_json(std::ostream& out,
+                const std::vector<latency_summary>& summaries) {
+
+    out << "[\n";
+    for (std::size_t i = 0; i < summaries.size(); ++i) {
+        const latency_summary& s = summaries[i];
+        out << "  {\"name\": \"" << s.name << "\", \"count\": " << s.count
+            << ", \"mean_ns\": " << s.mean.count()
+            << ", \"min_ns\": " << s.min.count()
+            << ", \"p50_ns\": " << s.p50.count()
+            << ", \"p90_ns\": " << s.p90.count()
+            << ", \"p99_ns\": " << s.p99.count()
+            << ", \"p999_ns\": " << s.p999.count()
+            << ", \"max_ns\": " << s.max.count()
+            << ", \"histogram_log2_us\": [";
+        for (std::size_t j = 0; j < s.histogram.size(); ++j) {
+            out << (j == 0 ? "" : ", ") << s.histogram[j];
+        }
+        out << "]}" << ((i + 1) < summaries.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+}
+
+}  // namespace traccc::performance
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -22,12 +22,16 @@ namespace traccc::performance {
 /// @param timer_name name to be printed out identifying what is measured
 /// @param t_info shared_ptr to timing_info where to store timings
 timer::timer(const std::string_view timer_name, timing_info& t_info)
-    : m_start(std::chrono::high_resolution_clock::now()),
+    : m_counters(hardware_counters::this_thread()),
       m_name(timer_name),
       m_timing_info(t_info) {
 #ifdef TRACCC_HAVE_NVTX
     nvtxRangePushA(timer_name.data());
 #endif  // TRACCC_HAVE_NVTX
+    if (m_counters != nullptr) {
+        m_start_counts = m_counters->read();
+    }
+    m_start = std::chrono::high_resolution_clock::now();
 }
 
 /// End time measurement
@@ -37,6 +41,19 @@ timer::~timer() {
 #endif  // TRACCC_HAVE_NVTX
     const auto end = std::chrono::high_resolution_clock::now();
     const std::chrono::nanoseconds totalTime = end - m_start;
+    if (m_counters != nullptr) {
+        const hardware_counts counts = m_counters->read() - m_start_counts;
+        const auto cpos = std::find_if(
+            m_timing_info.counters.begin(), m_timing_info.counters.end(),
+            [&name = m_name](const counter_info_pair& element) {
+                return element.first == name;
+            });
+        if (cpos == m_timing_info.counters.end()) {
+            m_timing_info.counters.push_back({m_name, counts});
+        } else {
+            cpos->second += counts;
+        }
+    }
     const auto pos =
         std::find_if(m_timing_info.data.begin(), m_timing_info.data.end(),
                      [&name = m_name](const timing_info_pair& element) {
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2022-2023 CERN for the benefit of the ACTS project
+ * (c) 2022-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -29,6 +29,18 @@ std::chrono::nanoseconds timing_info::get_time(
     return it->second;
 }
 
+hardware_counts timing_info::get_counts(std::string_view timer_name) const {
+
+    auto it = std::find_if(counters.begin(), counters.end(),
+                           [&timer_name](const counter_info_pair& itr) {
+                               return itr.first == timer_name;
+                           });
+    if (it == counters.end()) {
+        throw std::invalid_argument("Unknown component name received");
+    }
+    return it->second;
+}
+
 std::ostream& operator<<(std::ostream& out, const timing_info& info) {
 
     for (std::size_t i = 0; i < info.data.size(); ++i) {
@@ -287,18 +287,20 @@ void event_data::setup_csv(bool use_acts_geom_source, const host_detector* det,
 
 void event_data::fill_cca_result(
     const edm::silicon_cell_collection::host& cells,
-    const edm::silicon_cluster_collection::host& cca_clusters,
+    const edm::silicon_cluster_collection::const_view& cca_clusters_view,
     const edm::measurement_collection::host& cca_measurements,
     const detector_conditions_description::host& det_cond) {
 
     const std::size_t n_cca_clusters = cca_measurements.size();
+    const edm::silicon_cluster_collection::const_device cca_clusters{
+        cca_clusters_view};
 
     std::map<measurement_proxy, std::vector<io::csv::cell>>
         found_meas_to_cluster_map;
 
     for (std::size_t i = 0; i < n_cca_clusters; i++) {
         const auto meas = cca_measurements.at(i);
-        const auto cluster = cca_clusters[i];
+        const auto cluster = cca_clusters.at(static_cast<unsigned int>(i));
 
         std::vector<io::csv::cell> iocells;
         for (const unsigned int cell_idx : cluster.cell_indices()) {
@@ -0,0 +1,62 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+// POSIX include(s).
+#include <unistd.h>
+
+namespace traccc::tests {
+
+/// Temporary directory of the current test, removed with all of its contents
+///
+/// Its name is made from the name of the running test and the process
+/// identifier, so that tests running in parallel (from one or multiple
+/// processes) would not write into each other's files.
+///
+class temp_directory {
+
+    public:
+    /// Create the directory
+    temp_directory() {
+        const ::testing::TestInfo* info =
+            ::testing::UnitTest::GetInstance()->current_test_info();
+        m_path = std::filesystem::temp_directory_path() /
+                 (std::string{"traccc_"} + info->test_suite_name() + "_" +
+                  info->name() + "_" + std::to_string(::getpid()));
+        std::filesystem::remove_all(m_path);
+        std::filesystem::create_directories(m_path);
+    }
+    /// Disallow copying
+    temp_directory(const temp_directory&) = delete;
+    /// Remove the directory
+    ~temp_directory() {
+        std::error_code ec;
+        std::filesystem::remove_all(m_path, ec);
+    }
+
+    /// Disallow copying
+    temp_directory& operator=(const temp_directory&) = delete;
+
+    /// Get the path of the directory
+    const std::filesystem::path& path() const { return m_path; }
+
+    private:
+    /// The path of the directory
+    std::filesystem::path m_path;
+
+};  // class temp_directory
+
+}  // namespace traccc::tests
@@ -0,0 +1,62 @@
+/**
+ * traccc library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "traccc/utils/radix_sort.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+TEST(radix_sort, random_keys) {
+
+    std::mt19937_64 gen{42u};
+    std::vector<std::uint64_t> values(10000u);
+    for (std::uint64_t& value : values) {
+        value = gen();
+    }
+    std::vector<std::uint64_t> reference = values;
+    std::sort(reference.begin(), reference.end());
+
+    traccc::radix_sort(values, [](std::uint64_t value) { return value; });
+    EXPECT_EQ(values, reference);
+}
+
+TEST(radix_sort, stable_multi_key) {
+
+    // Elements with two keys, and their original position.
+    struct element {
+        std::uint32_t major;
+        std::uint16_t minor;
+        std::size_t position;
+    };
+    std::mt19937 gen{123u};
+    std::vector<element> values(5000u);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = {static_cast<std::uint32_t>(gen() % 20u),
+                     static_cast<std::uint16_t>(gen() % 30u), i};
+    }
+    std::vector<element> reference = values;
+    std::stable_sort(reference.begin(), reference.end(),
+                     [](const element& lhs, const element& rhs) {
+                         return std::pair{lhs.major, lhs.minor} <
+                                std::pair{rhs.major, rhs.minor};
+                     });
+
+    // Sort by the least significant key first.
+    traccc::radix_sort(values, [](const element& e) { return e.minor; });
+    traccc::radix_sort(values, [](const element& e) { return e.major; });
+    ASSERT_EQ(values.size(), reference.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i].position, reference[i].position);
+    }
+}
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2025 CERN for the benefit of the ACTS project
+ * (c) 2021-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -68,13 +68,14 @@ TEST(algorithms, seq_single_module) {
 
     auto cells_data = vecmem::get_data(cells);
     auto clusters = cc(cells_data, vecmem::get_data(det_cond));
-    EXPECT_EQ(clusters.size(), 4u);
+    EXPECT_EQ(
+        traccc::edm::silicon_cluster_collection::const_device{clusters}.size(),
+        4u);
 
-    auto clusters_data = vecmem::get_data(clusters);
     auto det_desc_data = vecmem::get_data(det_desc);
     auto det_cond_data = vecmem::get_data(det_cond);
     auto measurements =
-        mc(cells_data, clusters_data, det_desc_data, det_cond_data);
+        mc(cells_data, clusters, det_desc_data, det_cond_data);
 
     EXPECT_EQ(measurements.size(), 4u);
 }
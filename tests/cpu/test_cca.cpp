@@ -7,6 +7,8 @@
 
 // Project include(s).
 #include "traccc/clusterization/clusterization_algorithm.hpp"
+#include "traccc/clusterization/measurement_creation_algorithm.hpp"
+#include "traccc/clusterization/sparse_ccl_algorithm.hpp"
 #include "traccc/definitions/primitives.hpp"
 #include "traccc/edm/silicon_cell_collection.hpp"
 #include "traccc/geometry/detector_conditions_description.hpp"
@@ -47,9 +49,36 @@ cca_function_t f =
     const traccc::detector_conditions_description::const_data det_cond_data =
         vecmem::get_data(det_cond);
     const auto clusters = cc(cells_data, det_cond_data);
-    const auto clusters_data = vecmem::get_data(clusters);
-    auto measurements =
-        mc(cells_data, clusters_data, det_desc_data, det_cond_data);
+    auto measurements = mc(cells_data, clusters, det_desc_data, det_cond_data);
+
+    for (std::size_t i = 0; i < measurements.size(); i++) {
+        if (result.contains(measurements.at(i).surface_link().value()) ==
+            false) {
+            result.insert(
+                {measurements.at(i).surface_link().value(),
+                 traccc::edm::measurement_collection::host{resource}});
+        }
+        result.at(measurements.at(i).surface_link().value())
+            .push_back(measurements.at(i));
+    }
+
+    return {std::move(result), std::nullopt};
+};
+
+traccc::host::clusterization_algorithm ca(resource);
+
+cca_function_t f_fused =
+    [](const traccc::edm::silicon_cell_collection::host& cells,
+       const traccc::detector_design_description::host& det_desc,
+       const traccc::detector_conditions_description::host& det_cond)
+    -> std::pair<std::map<traccc::geometry_id,
+                          traccc::edm::measurement_collection::host>,
+                 std::optional<traccc::edm::silicon_cluster_collection::host>> {
+    std::map<traccc::geometry_id, traccc::edm::measurement_collection::host>
+        result;
+
+    auto measurements = ca(vecmem::get_data(cells), vecmem::get_data(det_desc),
+                           vecmem::get_data(det_cond));
 
     for (std::size_t i = 0; i < measurements.size(); i++) {
         if (result.contains(measurements.at(i).surface_link().value()) ==
@@ -76,3 +105,10 @@ INSTANTIATE_TEST_SUITE_P(
         ::testing::Values(f),
         ::testing::ValuesIn(ConnectedComponentAnalysisTests::get_test_files())),
     ConnectedComponentAnalysisTests::get_test_name);
+
+INSTANTIATE_TEST_SUITE_P(
+    ClusterizationAlgorithm, ConnectedComponentAnalysisTests,
+    ::testing::Combine(
+        ::testing::Values(f_fused),
+        ::testing::ValuesIn(ConnectedComponentAnalysisTests::get_test_files())),
+    ConnectedComponentAnalysisTests::get_test_name);
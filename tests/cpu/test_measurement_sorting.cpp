@@ -0,0 +1,82 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/clusterization/measurement_sorting_algorithm.hpp"
+#include "traccc/edm/measurement_collection.hpp"
+
+// Detray include(s).
+#include <detray/geometry/identifier.hpp>
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+TEST(measurement_sorting_algorithm, random_measurements) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource resource;
+
+    // Create measurements with many equal surfaces, positions and variances,
+    // to exercise every sorting key. The identifier of every measurement is
+    // its original index.
+    static constexpr unsigned int NMEASUREMENTS = 10000;
+    std::mt19937 rng{42u};
+    std::uniform_int_distribution<unsigned int> surface{0u, 50u};
+    std::uniform_int_distribution<int> value{-3, 3};
+    traccc::edm::measurement_collection::host measurements{resource};
+    for (unsigned int i = 0; i < NMEASUREMENTS; ++i) {
+        const auto position = [&]() {
+            const int v = value(rng);
+            // Produce both negative and positive zeros.
+            return (v == 3) ? -0.f : static_cast<float>(v) * 0.5f;
+        };
+        measurements.push_back(
+            {{position(), position()},
+             {std::abs(position()), std::abs(position())},
+             2u,
+             0.f,
+             0.f,
+             i,
+             detray::geometry::identifier{surface(rng)},
+             {0u, 1u},
+             i});
+    }
+
+    // Sort the measurements with the algorithm.
+    traccc::host::measurement_sorting_algorithm sort_alg{resource};
+    const traccc::edm::measurement_collection::host sorted =
+        sort_alg(vecmem::get_data(measurements));
+
+    // Sort the measurements with a (stable) comparison sort, as a reference.
+    std::vector<unsigned int> reference(NMEASUREMENTS);
+    std::iota(reference.begin(), reference.end(), 0u);
+    std::stable_sort(reference.begin(), reference.end(),
+                     [&](unsigned int lhs, unsigned int rhs) {
+                         return measurements.at(lhs) < measurements.at(rhs);
+                     });
+
+    // The two must agree exactly.
+    ASSERT_EQ(sorted.size(), NMEASUREMENTS);
+    for (unsigned int i = 0; i < NMEASUREMENTS; ++i) {
+        EXPECT_EQ(sorted.identifier()[i], reference[i]);
+        EXPECT_EQ(sorted.cluster_index()[i], reference[i]);
+        EXPECT_EQ(sorted.surface_link()[i],
+                  measurements.surface_link()[reference[i]]);
+        EXPECT_EQ(sorted.local_position()[i],
+                  measurements.local_position()[reference[i]]);
+    }
+}
@@ -0,0 +1,192 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/clusterization/details/simd_sparse_ccl.hpp"
+#include "traccc/clusterization/details/sparse_ccl.hpp"
+#include "traccc/clusterization/sparse_ccl_algorithm.hpp"
+#include "traccc/edm/silicon_cell_collection.hpp"
+#include "traccc/edm/silicon_cluster_collection.hpp"
+#include "traccc/geometry/detector_conditions_description.hpp"
+
+// VecMem include(s).
+#include <vecmem/containers/device_vector.hpp>
+#include <vecmem/containers/vector.hpp>
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstddef>
+#include <random>
+
+namespace {
+
+/// The number of modules in the test events
+constexpr unsigned int NMODULES = 500;
+
+/// Create an event with cells on many modules
+///
+/// @param resource  The memory resource to use
+/// @param occupancy The fraction of the channels that have an active cell
+/// @return The cells of the event
+///
+traccc::edm::silicon_cell_collection::host make_cells(
+    vecmem::memory_resource& resource, double occupancy) {
+
+    // Create an event with enough cells on enough modules, for the algorithm
+    // to split it into multiple chunks on a multi-core machine.
+    static constexpr traccc::channel_id NCHANNELS = 50;
+    std::mt19937 rng{42u};
+    std::bernoulli_distribution is_active{occupancy};
+    traccc::edm::silicon_cell_collection::host cells{resource};
+    for (unsigned int module = 0; module < NMODULES; ++module) {
+        for (traccc::channel_id ch1 = 0; ch1 < NCHANNELS; ++ch1) {
+            for (traccc::channel_id ch0 = 0; ch0 < NCHANNELS; ++ch0) {
+                if (is_active(rng)) {
+                    cells.push_back({ch0, ch1, 1.f, 0.f, module});
+                }
+            }
+        }
+    }
+    return cells;
+}
+
+/// Label all cells in one go with the scalar SparseCCL code, as a reference
+///
+/// @param cells  The cells to label
+/// @param labels The labels of the cells (output)
+/// @return The number of clusters found
+///
+unsigned int reference_labels(
+    const traccc::edm::silicon_cell_collection::host& cells,
+    vecmem::vector<unsigned int>& labels) {
+
+    labels.resize(cells.size());
+    vecmem::device_vector<unsigned int> labels_device{
+        vecmem::get_data(labels)};
+    return traccc::details::sparse_ccl(
+        traccc::edm::silicon_cell_collection::const_device{
+            vecmem::get_data(cells)},
+        labels_device);
+}
+
+/// Compare the clusters of the algorithm with the ones of the scalar SparseCCL
+///
+/// @param occupancy The fraction of the channels that have an active cell
+///
+void test_many_modules(double occupancy) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource resource;
+
+    // Create the test event.
+    const traccc::edm::silicon_cell_collection::host cells =
+        make_cells(resource, occupancy);
+    traccc::detector_conditions_description::host det_cond{resource};
+    det_cond.resize(NMODULES);
+    const traccc::detector_conditions_description::const_data det_cond_data =
+        vecmem::get_data(det_cond);
+
+    // Label all cells in one go with the scalar code, as a reference.
+    vecmem::vector<unsigned int> ref_labels{&resource};
+    const unsigned int ref_n_clusters = reference_labels(cells, ref_labels);
+
+    // Run the algorithm, letting it split the event into multiple chunks.
+    const traccc::edm::silicon_cell_collection::const_data cells_data =
+        vecmem::get_data(cells);
+    traccc::host::sparse_ccl_algorithm cc(resource);
+    cc.set_intra_event_parallelism(true);
+    const auto clusters_buffer = cc(cells_data, det_cond_data);
+    const traccc::edm::silicon_cluster_collection::const_device clusters{
+        clusters_buffer};
+
+    // The clusters must be the same as the reference ones.
+    ASSERT_EQ(clusters.size(), ref_n_clusters);
+    std::size_t n_cells = 0;
+    for (unsigned int i = 0; i < clusters.size(); ++i) {
+        n_cells += clusters.cell_indices()[i].size();
+        for (unsigned int cell_idx : clusters.cell_indices()[i]) {
+            EXPECT_EQ(ref_labels[cell_idx], i);
+        }
+    }
+    EXPECT_EQ(n_cells, cells.size());
+}
+
+/// Compare one implementation of the vectorised SparseCCL with the scalar one
+///
+/// @param scan The implementation of the adjacency scan to test
+///
+void test_scan(traccc::host::details::sparse_ccl_scan scan) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource resource;
+
+    for (double occupancy : {0.05, 0.2, 0.9}) {
+
+        // Create the test event.
+        const traccc::edm::silicon_cell_collection::host cells =
+            make_cells(resource, occupancy);
+        const auto n_cells = static_cast<unsigned int>(cells.size());
+
+        // Label the cells with the scalar code, as a reference.
+        vecmem::vector<unsigned int> ref_labels{&resource};
+        const unsigned int ref_n_clusters =
+            reference_labels(cells, ref_labels);
+
+        // Label the cells with the requested implementation.
+        vecmem::vector<unsigned int> labels{n_cells, &resource};
+        vecmem::device_vector<unsigned int> labels_device{
+            vecmem::get_data(labels)};
+        const unsigned int n_clusters =
+            traccc::host::details::simd_sparse_ccl(
+                traccc::edm::silicon_cell_collection::const_device{
+                    vecmem::get_data(cells)},
+                labels_device, 0u, n_cells, scan);
+
+        // The labels must be exactly the same.
+        ASSERT_EQ(n_clusters, ref_n_clusters);
+        for (unsigned int i = 0; i < n_cells; ++i) {
+            ASSERT_EQ(labels[i], ref_labels[i]) << "cell " << i;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(sparse_ccl_algorithm, many_modules) {
+    test_many_modules(0.2);
+}
+
+TEST(sparse_ccl_algorithm, many_dense_modules) {
+    test_many_modules(0.9);
+}
+
+TEST(simd_sparse_ccl, scalar) {
+    test_scan(traccc::host::details::sparse_ccl_scan::scalar);
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+
+TEST(simd_sparse_ccl, avx2) {
+    __builtin_cpu_init();
+    if (!__builtin_cpu_supports("avx2")) {
+        GTEST_SKIP() << "The CPU does not support AVX2";
+    }
+    test_scan(traccc::host::details::sparse_ccl_scan::avx2);
+}
+
+TEST(simd_sparse_ccl, avx512) {
+    __builtin_cpu_init();
+    if (!__builtin_cpu_supports("avx512f")) {
+        GTEST_SKIP() << "The CPU does not support AVX-512";
+    }
+    test_scan(traccc::host::details::sparse_ccl_scan::avx512);
+}
+
+#endif
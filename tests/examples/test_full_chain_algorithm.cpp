@@ -0,0 +1,126 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/examples/cpu/full_chain_algorithm.hpp"
+#include "traccc/examples/make_magnetic_field.hpp"
+#include "traccc/geometry/host_detector.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_detector.hpp"
+#include "traccc/io/read_detector_description.hpp"
+#include "traccc/options/clusterization.hpp"
+#include "traccc/options/detector.hpp"
+#include "traccc/options/input_data.hpp"
+#include "traccc/options/magnetic_field.hpp"
+#include "traccc/options/track_finding.hpp"
+#include "traccc/options/track_fitting.hpp"
+#include "traccc/options/track_gbts_seeding.hpp"
+#include "traccc/options/track_propagation.hpp"
+#include "traccc/options/track_seeding.hpp"
+#include "traccc/seeding/detail/track_params_estimation_config.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// TBB include(s).
+#include <tbb/task_arena.h>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <memory>
+
+// The reconstructed tracks must not depend on whether (and with how many
+// threads) the events are reconstructed with intra-event parallelism.
+TEST(full_chain_algorithm, intra_event_parallelism) {
+
+    // Memory resource used in the test.
+    vecmem::host_memory_resource host_mr;
+
+    // Use the default configuration of the throughput applications.
+    traccc::opts::detector detector_opts;
+    traccc::opts::magnetic_field bfield_opts;
+    traccc::opts::input_data input_opts;
+    traccc::opts::clusterization clusterization_opts;
+    traccc::opts::track_seeding seeding_opts;
+    traccc::opts::track_gbts_seeding seeding_gbts_opts;
+    traccc::opts::track_finding finding_opts;
+    traccc::opts::track_propagation propagation_opts;
+    traccc::opts::track_fitting fitting_opts;
+
+    // Read the detector and the cells of the first event.
+    traccc::detector_design_description::host det_descr{host_mr};
+    traccc::detector_conditions_description::host det_cond{host_mr};
+    traccc::io::read_detector_description(
+        det_descr, det_cond, detector_opts.detector_file,
+        detector_opts.digitization_file, detector_opts.conditions_file,
+        traccc::data_format::json);
+    traccc::host_detector detector;
+    traccc::io::read_detector(detector, host_mr, detector_opts.detector_file,
+                              detector_opts.material_file,
+                              detector_opts.grid_file);
+    const traccc::magnetic_field field =
+        traccc::details::make_magnetic_field(bfield_opts);
+    traccc::edm::silicon_cell_collection::host cells{host_mr};
+    traccc::io::read_cells(cells, input_opts.skip, input_opts.directory,
+                           traccc::getDummyLogger().clone(), &det_cond,
+                           input_opts.format, true,
+                           input_opts.use_acts_geom_source);
+
+    // Set up the algorithm.
+    const detray::propagation::config propagation_config(propagation_opts);
+    traccc::full_chain_algorithm::finding_algorithm::config_type finding_cfg(
+        finding_opts);
+    finding_cfg.propagation = propagation_config;
+    traccc::full_chain_algorithm::fitting_algorithm::config_type fitting_cfg(
+        fitting_opts);
+    fitting_cfg.propagation = propagation_config;
+    traccc::full_chain_algorithm alg(
+        host_mr,
+        traccc::full_chain_algorithm::clustering_algorithm::config_type(
+            clusterization_opts),
+        traccc::seedfinder_config(seeding_opts),
+        traccc::spacepoint_grid_config(seeding_opts),
+        traccc::seedfilter_config(seeding_opts),
+        traccc::gbts_seedfinder_config(seeding_gbts_opts),
+        traccc::track_params_estimation_config{}, finding_cfg, fitting_cfg,
+        det_descr, det_cond, field, &detector,
+        traccc::getDummyLogger().clone());
+
+    // Reconstruct the event serially.
+    const traccc::full_chain_algorithm::output_type serial = alg(cells);
+    ASSERT_GT(serial.size(), 0u);
+
+    // Reconstruct the event in parallel, with a fixed number of threads.
+    alg.set_intra_event_parallelism(true);
+    tbb::task_arena arena{4};
+    const traccc::full_chain_algorithm::output_type parallel =
+        arena.execute([&]() { return alg(cells); });
+
+    // The two must be identical.
+    ASSERT_EQ(parallel.size(), serial.size());
+    for (unsigned int i = 0; i < serial.size(); ++i) {
+        EXPECT_EQ(parallel.fit_outcome()[i], serial.fit_outcome()[i]);
+        const auto& parallel_params = parallel.params()[i];
+        const auto& serial_params = serial.params()[i];
+        EXPECT_EQ(parallel_params.surface_link(), serial_params.surface_link());
+        EXPECT_EQ(parallel_params.bound_local()[0],
+                  serial_params.bound_local()[0]);
+        EXPECT_EQ(parallel_params.bound_local()[1],
+                  serial_params.bound_local()[1]);
+        EXPECT_EQ(parallel_params.phi(), serial_params.phi());
+        EXPECT_EQ(parallel_params.theta(), serial_params.theta());
+        EXPECT_EQ(parallel_params.qop(), serial_params.qop());
+        EXPECT_EQ(parallel.ndf()[i], serial.ndf()[i]);
+        EXPECT_EQ(parallel.chi2()[i], serial.chi2()[i]);
+        EXPECT_EQ(parallel.pval()[i], serial.pval()[i]);
+        EXPECT_EQ(parallel.nholes()[i], serial.nholes()[i]);
+        EXPECT_EQ(parallel.constituent_links()[i],
+                  serial.constituent_links()[i]);
+    }
+}
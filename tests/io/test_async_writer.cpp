@@ -0,0 +1,131 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/async_writer.hpp"
+#include "traccc/io/read_measurements.hpp"
+
+// Test include(s).
+#include "tests/temp_directory.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(io_async_writer, backpressure) {
+
+    // Set up a writer with a single thread, and space for two tasks.
+    traccc::io::async_writer writer{
+        traccc::io::async_writer::config{.n_threads = 1u, .max_queued = 2u}};
+
+    // Block the background thread with a first task.
+    std::atomic_bool release{false};
+    writer.submit([&release]() {
+        while (!release) {
+            std::this_thread::yield();
+        }
+    });
+
+    // Fill up the queue, using move-only tasks.
+    std::vector<int> order;
+    for (int i = 0; i < 2; ++i) {
+        writer.submit([&order, value = std::make_unique<int>(i)]() {
+            order.push_back(*value);
+        });
+    }
+
+    // The next submission must block until the first task finishes.
+    std::atomic_bool submitted{false};
+    std::thread submitter{[&]() {
+        writer.submit([&order]() { order.push_back(2); });
+        submitted = true;
+    }};
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(submitted);
+    EXPECT_GE(writer.pending(), 3u);
+
+    // Let the tasks run, and make sure that they all finished, in order.
+    release = true;
+    submitter.join();
+    writer.flush();
+    EXPECT_TRUE(submitted);
+    EXPECT_EQ(writer.pending(), 0u);
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+}
+
+TEST(io_async_writer, errors) {
+
+    for (std::size_t n_threads : {0u, 2u}) {
+
+        traccc::io::async_writer writer{traccc::io::async_writer::config{
+            .n_threads = n_threads, .max_queued = 1u}};
+
+        // Errors must show up at the latest when flushing the writer, and
+        // must only be reported once.
+        EXPECT_THROW(
+            {
+                writer.submit([]() { throw std::runtime_error("Failed"); });
+                writer.flush();
+            },
+            std::runtime_error);
+        EXPECT_NO_THROW(writer.flush());
+    }
+    EXPECT_THROW(traccc::io::async_writer{
+                     traccc::io::async_writer::config{.max_queued = 0u}},
+                 std::invalid_argument);
+}
+
+TEST(io_async_writer, measurements) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource mr;
+
+    // Write a couple of events from background threads, handing the
+    // collections over to the writer.
+    const traccc::tests::temp_directory temp_dir;
+    const std::string directory = temp_dir.path().native();
+    static constexpr std::size_t n_events = 5u;
+    {
+        traccc::io::async_writer writer{
+            traccc::io::async_writer::config{.n_threads = 2u}};
+        for (std::size_t event = 0; event < n_events; ++event) {
+            traccc::edm::measurement_collection::host measurements{mr};
+            measurements.resize(event + 1u);
+            for (unsigned int i = 0; i < measurements.size(); ++i) {
+                measurements.cluster_index().at(i) =
+                    static_cast<unsigned int>(10u * event) + i;
+            }
+            writer.write(event, directory, traccc::data_format::binary,
+                         std::move(measurements));
+        }
+        // Let the destructor take care of finishing the writes.
+    }
+
+    // Read the events back.
+    for (std::size_t event = 0; event < n_events; ++event) {
+        traccc::edm::measurement_collection::host measurements{mr};
+        traccc::io::read_measurements(measurements, event, directory, nullptr,
+                                      nullptr, nullptr, false,
+                                      traccc::data_format::binary);
+        ASSERT_EQ(measurements.size(), event + 1u);
+        for (unsigned int i = 0; i < measurements.size(); ++i) {
+            EXPECT_EQ(measurements.cluster_index().at(i),
+                      static_cast<unsigned int>(10u * event) + i);
+        }
+    }
+}
@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2025 CERN for the benefit of the ACTS project
+ * (c) 2025-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -13,6 +13,9 @@
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <stdexcept>
+
 TEST(io_bfield, read_odd_binary_field) {
 
     // Read in the binary ODD file.
@@ -33,3 +36,14 @@ TEST(io_bfield, read_odd_binary_field) {
         static_cast<float>(field_view.at(0, 0, 0)[2]) / traccc::unit<float>::T,
         2.f, 0.01f);
 }
+
+TEST(io_bfield, missing_file) {
+
+    // A missing file must be reported the same way as before the reading
+    // was done through a memory mapping.
+    traccc::magnetic_field field;
+    EXPECT_THROW(traccc::io::read_magnetic_field(
+                     field, "geometries/odd/no-such-bfield.cvf",
+                     traccc::data_format::binary),
+                 std::invalid_argument);
+}
@@ -0,0 +1,172 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_detector_description.hpp"
+#include "traccc/io/read_measurements.hpp"
+#include "traccc/io/utils.hpp"
+#include "traccc/io/write.hpp"
+
+// Test include(s).
+#include "tests/data_test.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+class io_compressed : public traccc::tests::data_test {};
+
+TEST_F(io_compressed, odd_single_muon_cells) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource mr;
+
+    // Read the ODD detector description.
+    traccc::detector_design_description::host det_desc{mr};
+    traccc::detector_conditions_description::host det_cond{mr};
+    traccc::io::read_detector_description(
+        det_desc, det_cond, "geometries/odd/odd-detray_geometry_detray.json",
+        "geometries/odd/odd-digi-geometric-config.json",
+        "geometries/odd/odd-digi-geometric-config.json");
+
+    // Cell collections to use in the test.
+    traccc::edm::silicon_cell_collection::host orig{mr}, copy{mr};
+
+    // Test the I/O for 10 events.
+    const std::filesystem::path directory =
+        std::filesystem::temp_directory_path();
+    for (std::size_t event = 0; event < 10; ++event) {
+
+        // Read the cells for the current event.
+        traccc::io::read_cells(orig, event, "odd/geant4_1muon_1GeV/",
+                               traccc::getDummyLogger().clone(), &det_cond);
+        // Write the cells into temporary files, in both binary formats.
+        for (traccc::data_format format :
+             {traccc::data_format::binary, traccc::data_format::compressed}) {
+            traccc::io::write(event, directory.native(), format,
+                              vecmem::get_data(orig),
+                              vecmem::get_data(det_desc),
+                              vecmem::get_data(det_cond));
+        }
+
+        // The compressed file must be smaller than the uncompressed one.
+        EXPECT_LT(std::filesystem::file_size(
+                      directory /
+                      traccc::io::get_event_filename(event, "-cells.zdat")),
+                  std::filesystem::file_size(
+                      directory /
+                      traccc::io::get_event_filename(event, "-cells.dat")));
+
+        // Read the cells back in.
+        traccc::io::read_cells(copy, event, directory.native(),
+                               traccc::getDummyLogger().clone(), &det_cond,
+                               traccc::data_format::compressed);
+        ASSERT_EQ(orig.size(), copy.size());
+        for (traccc::edm::silicon_cell_collection::host::size_type i = 0;
+             i < orig.size(); ++i) {
+            EXPECT_EQ(orig.at(i), copy.at(i));
+        }
+    }
+}
+
+TEST(io_compressed, measurements) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource mr;
+
+    // Create a measurement collection with some recognisable values. Large
+    // enough to have repeating patterns for the compressor to find.
+    traccc::edm::measurement_collection::host orig{mr};
+    orig.resize(1000u);
+    for (unsigned int i = 0; i < orig.size(); ++i) {
+        orig.local_position().at(i) = {static_cast<float>(i % 17), 2.f};
+        orig.time().at(i) = 0.5f * static_cast<float>(i);
+        orig.subspace().at(i) = {static_cast<std::uint8_t>(i % 2), 1u};
+        orig.cluster_index().at(i) = 100u + i;
+    }
+
+    // Write it out, and read it back in.
+    const std::string directory =
+        std::filesystem::temp_directory_path().native();
+    traccc::io::write(0u, directory, traccc::data_format::compressed,
+                      vecmem::get_data(orig));
+    traccc::edm::measurement_collection::host copy{mr};
+    traccc::io::read_measurements(copy, 0u, directory, nullptr, nullptr,
+                                  nullptr, false,
+                                  traccc::data_format::compressed);
+    ASSERT_EQ(copy.size(), orig.size());
+    EXPECT_EQ(copy.local_position(), orig.local_position());
+    EXPECT_EQ(copy.time(), orig.time());
+    EXPECT_EQ(copy.subspace(), orig.subspace());
+    EXPECT_EQ(copy.cluster_index(), orig.cluster_index());
+}
+
+TEST(io_compressed, invalid_file) {
+
+    // Write a file that is not in the compressed format.
+    const std::filesystem::path filename =
+        std::filesystem::temp_directory_path() / "event000000000-cells.zdat";
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file << "This is not a compressed SoA file, but it's long enough.";
+    }
+
+    // Make sure that it is rejected.
+    vecmem::host_memory_resource mr;
+    traccc::edm::silicon_cell_collection::host cells{mr};
+    EXPECT_THROW(traccc::io::read_cells(cells, 0u,
+                                        filename.parent_path().native(),
+                                        traccc::getDummyLogger().clone(),
+                                        nullptr,
+                                        traccc::data_format::compressed),
+                 std::runtime_error);
+}
+
+TEST(io_compressed, inconsistent_column) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource mr;
+
+    // Write a valid file.
+    const std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "io_compressed_inconsistent";
+    std::filesystem::create_directories(directory);
+    traccc::edm::measurement_collection::host orig{mr};
+    orig.resize(100u);
+    traccc::io::write(0u, directory.native(), traccc::data_format::compressed,
+                      vecmem::get_data(orig));
+
+    // Change the element count of its first column, so that it would not
+    // match the size of the container anymore. The count follows the 24 byte
+    // file header and the 8 byte element size of the column.
+    {
+        std::fstream file(
+            directory /
+                traccc::io::get_event_filename(0u, "-measurements.zdat"),
+            std::ios::binary | std::ios::in | std::ios::out);
+        const std::uint64_t count = 99u;
+        file.seekp(24 + 8);
+        file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    }
+
+    // Make sure that the file is rejected.
+    traccc::edm::measurement_collection::host copy{mr};
+    EXPECT_THROW(traccc::io::read_measurements(
+                     copy, 0u, directory.native(), nullptr, nullptr, nullptr,
+                     false, traccc::data_format::compressed),
+                 std::runtime_error);
+    std::filesystem::remove_all(directory);
+}
@@ -7,6 +7,8 @@
 
 // Project include(s).
 #include "traccc/geometry/detector.hpp"
+#include "traccc/io/csv/make_cell_reader.hpp"
+#include "traccc/io/csv/make_measurement_reader.hpp"
 #include "traccc/io/read_cells.hpp"
 #include "traccc/io/read_detector.hpp"
 #include "traccc/io/read_detector_description.hpp"
@@ -14,6 +16,7 @@
 #include "traccc/io/read_measurements.hpp"
 #include "traccc/io/read_particles.hpp"
 #include "traccc/io/read_spacepoints.hpp"
+#include "traccc/io/serial_reading.hpp"
 #include "traccc/io/write.hpp"
 
 // Test include(s).
@@ -27,6 +30,10 @@
 
 // System include(s).
 #include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
 
 class io : public traccc::tests::data_test {};
 
@@ -90,6 +97,35 @@ TEST_F(io, csv_read_tml_pixelbarrel) {
     EXPECT_EQ(cells.size(), 179961u);
 }
 
+// Reading a large file serially must give the same result as reading it in
+// parallel chunks.
+TEST_F(io, csv_read_tml_pixelbarrel_serial) {
+
+    vecmem::host_memory_resource resource;
+
+    traccc::edm::silicon_cell_collection::host parallel_cells{resource};
+    traccc::io::read_cells(
+        parallel_cells,
+        get_datafile("tml_pixel_barrel/event000000000-cells.csv"));
+
+    traccc::edm::silicon_cell_collection::host serial_cells{resource};
+    EXPECT_FALSE(traccc::io::is_serial_reading());
+    {
+        const traccc::io::serial_reading serial;
+        EXPECT_TRUE(traccc::io::is_serial_reading());
+        traccc::io::read_cells(
+            serial_cells,
+            get_datafile("tml_pixel_barrel/event000000000-cells.csv"));
+    }
+    EXPECT_FALSE(traccc::io::is_serial_reading());
+
+    ASSERT_EQ(serial_cells.size(), parallel_cells.size());
+    for (traccc::edm::silicon_cell_collection::host::size_type i = 0;
+         i < serial_cells.size(); ++i) {
+        EXPECT_EQ(serial_cells.at(i), parallel_cells.at(i));
+    }
+}
+
 /// Tests with ODD "single" muon events.
 TEST_F(io, csv_read_odd_single_muon) {
 
@@ -178,3 +214,76 @@ TEST_F(io, csv_write_odd_single_muon_cells) {
     perform_test(true);
     perform_test(false);
 }
+
+TEST_F(io, csv_record_reader) {
+
+    // Write a cell file with some unusual formatting.
+    const std::filesystem::path cells_file =
+        std::filesystem::temp_directory_path() / "record_reader-cells.csv";
+    {
+        std::ofstream file(cells_file, std::ios::binary);
+        file << "geometry_id,measurement_id,channel0,channel1,timestamp,"
+                "value,extra\r\n"
+             << "1152921779484753920,0,+12,34, 0,1.5e-2,foo\r\n"
+             << "\r\n"
+             << "2,3,4,5,6,7,8";
+    }
+
+    // Make sure that it is read correctly.
+    auto cell_reader = traccc::io::csv::make_cell_reader(cells_file.native());
+    traccc::io::csv::cell cell;
+    ASSERT_TRUE(cell_reader.read(cell));
+    EXPECT_EQ(cell.geometry_id, 1152921779484753920ull);
+    EXPECT_EQ(cell.channel0, 12u);
+    EXPECT_EQ(cell.channel1, 34u);
+    EXPECT_FLOAT_EQ(cell.value, 0.015f);
+    ASSERT_TRUE(cell_reader.read(cell));
+    EXPECT_EQ(cell.geometry_id, 2u);
+    EXPECT_FLOAT_EQ(cell.timestamp, 6.f);
+    EXPECT_FALSE(cell_reader.read(cell));
+
+    // Read the same file in (very small) chunks.
+    auto chunk_reader = traccc::io::csv::make_cell_reader(cells_file.native());
+    const std::vector<std::string_view> chunks = chunk_reader.split(10u, 1u);
+    ASSERT_EQ(chunks.size(), 2u);
+    std::vector<traccc::io::csv::cell> chunk_cells;
+    for (std::string_view chunk : chunks) {
+        while (chunk_reader.read(chunk, cell)) {
+            chunk_cells.push_back(cell);
+        }
+    }
+    ASSERT_EQ(chunk_cells.size(), 2u);
+    EXPECT_EQ(chunk_cells[0].channel0, 12u);
+    EXPECT_EQ(chunk_cells[1].geometry_id, 2u);
+
+    // Write a measurement file with some errors in it.
+    const std::filesystem::path meas_file =
+        std::filesystem::temp_directory_path() /
+        "record_reader-measurements.csv";
+    {
+        std::ofstream file(meas_file, std::ios::binary);
+        file << "measurement_id,geometry_id,local_key,local0,local1,phi,"
+                "theta,time,var_local0,var_local1,var_phi,var_theta,var_time\n"
+             << "1,2,6,1,1,1,1,1,1,1,1,1,1\n"
+             << "1,2,6,1,1,1,1\n"
+             << "1,2,6,1,1,1,1,1,1,1,1,1,1,1\n"
+             << "1,2,6,1,1,1,1,1,1,1,1,1,abc\n";
+    }
+
+    // Make sure that the errors are caught.
+    auto meas_reader =
+        traccc::io::csv::make_measurement_reader(meas_file.native());
+    traccc::io::csv::measurement meas;
+    ASSERT_TRUE(meas_reader.read(meas));
+    EXPECT_EQ(meas.local_key, 6u);
+    EXPECT_THROW(meas_reader.read(meas), std::runtime_error);
+    EXPECT_THROW(meas_reader.read(meas), std::runtime_error);
+    EXPECT_THROW(meas_reader.read(meas), std::runtime_error);
+    EXPECT_FALSE(meas_reader.read(meas));
+
+    // Make sure that a missing, mandatory column is noticed.
+    EXPECT_THROW(
+        traccc::io::csv::record_reader<traccc::io::csv::cell>(
+            meas_file.native()),
+        std::runtime_error);
+}
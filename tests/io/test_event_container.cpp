@@ -0,0 +1,236 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/details/event_container.hpp"
+#include "traccc/io/details/mapped_soa.hpp"
+#include "traccc/io/event_container.hpp"
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_detector_description.hpp"
+#include "traccc/io/read_measurements.hpp"
+#include "traccc/io/read_particles.hpp"
+
+// Test include(s).
+#include "tests/data_test.hpp"
+#include "tests/temp_directory.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+class io_event_container : public traccc::tests::data_test {};
+
+TEST_F(io_event_container, odd_single_muon) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource mr;
+
+    // Read the ODD detector description.
+    traccc::detector_design_description::host det_desc{mr};
+    traccc::detector_conditions_description::host det_cond{mr};
+    traccc::io::read_detector_description(
+        det_desc, det_cond, "geometries/odd/odd-detray_geometry_detray.json",
+        "geometries/odd/odd-digi-geometric-config.json",
+        "geometries/odd/odd-digi-geometric-config.json");
+
+    // Read the cells and particles of 10 events, and write them into a single
+    // event container file.
+    static constexpr std::size_t n_events = 10;
+    const std::string directory =
+        std::filesystem::temp_directory_path().native();
+    std::vector<traccc::edm::silicon_cell_collection::host> orig_cells;
+    std::vector<traccc::particle_collection_types::host> orig_particles;
+    {
+        traccc::io::event_container_writer writer{
+            traccc::io::get_event_container_filename(directory), 0u,
+            n_events};
+        // Write the events in reverse order, to make sure that the index
+        // takes care of finding them.
+        for (std::size_t i = 0; i < n_events; ++i) {
+            const std::size_t event = n_events - i - 1;
+            orig_cells.emplace_back(mr);
+            traccc::io::read_cells(orig_cells.back(), event,
+                                   "odd/geant4_1muon_1GeV/",
+                                   traccc::getDummyLogger().clone(),
+                                   &det_cond);
+            writer.write(event, vecmem::get_data(orig_cells.back()));
+            orig_particles.emplace_back(&mr);
+            traccc::io::read_particles(orig_particles.back(), event,
+                                       "odd/geant4_1muon_1GeV/");
+            writer.write(event, orig_particles.back());
+        }
+        writer.close();
+    }
+
+    // Read the events back in parallel, through the shared reader.
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < n_events; ++i) {
+        threads.emplace_back([&, i]() {
+            const std::size_t event = n_events - i - 1;
+
+            traccc::edm::silicon_cell_collection::host cells{mr};
+            traccc::io::read_cells(cells, event, directory,
+                                   traccc::getDummyLogger().clone(),
+                                   &det_cond, traccc::data_format::container);
+            ASSERT_EQ(cells.size(), orig_cells[i].size());
+            for (traccc::edm::silicon_cell_collection::host::size_type j = 0;
+                 j < cells.size(); ++j) {
+                EXPECT_EQ(cells.at(j), orig_cells[i].at(j));
+            }
+
+            traccc::particle_collection_types::host particles{&mr};
+            traccc::io::read_particles(particles, event, directory,
+                                       traccc::data_format::container);
+            ASSERT_EQ(particles.size(), orig_particles[i].size());
+            for (std::size_t j = 0; j < particles.size(); ++j) {
+                EXPECT_EQ(particles[j].particle_id,
+                          orig_particles[i][j].particle_id);
+                EXPECT_EQ(particles[j].momentum,
+                          orig_particles[i][j].momentum);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // The file must have been opened only once, with the reader kept open
+    // even after all of its users went away.
+    const std::string filename =
+        traccc::io::get_event_container_filename(directory);
+    const std::weak_ptr<const traccc::io::event_container_reader> reader =
+        traccc::io::event_container_reader::open(filename);
+    EXPECT_FALSE(reader.expired());
+    EXPECT_EQ(traccc::io::event_container_reader::open(filename),
+              reader.lock());
+}
+
+TEST(io_event_container, random_access) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource mr;
+
+    // Create measurement collections of different sizes for a few events.
+    const std::string filename = (std::filesystem::temp_directory_path() /
+                                  "random_access.trcc")
+                                     .native();
+    {
+        traccc::io::event_container_writer writer{filename, 5u, 3u};
+        for (unsigned int event = 5u; event < 8u; ++event) {
+            traccc::edm::measurement_collection::host measurements{mr};
+            measurements.resize(event);
+            for (unsigned int i = 0; i < measurements.size(); ++i) {
+                measurements.cluster_index().at(i) = 10u * event + i;
+            }
+            writer.write(event, vecmem::get_data(measurements));
+        }
+        // Write (empty) particles for just one event.
+        writer.write(6u, traccc::particle_collection_types::host{&mr});
+        // Make sure that data can not be written twice for an event, or
+        // outside of the range of the file.
+        EXPECT_THROW(
+            writer.write(6u, traccc::edm::measurement_collection::const_view{}),
+            std::logic_error);
+        EXPECT_THROW(
+            writer.write(8u, traccc::edm::measurement_collection::const_view{}),
+            std::out_of_range);
+    }
+
+    // Check the file's content, without copying it.
+    const traccc::io::event_container_reader reader{filename};
+    EXPECT_EQ(reader.first_event(), 5u);
+    EXPECT_EQ(reader.n_events(), 3u);
+    EXPECT_FALSE(reader.contains(4u, traccc::io::event_data_type::cells));
+    EXPECT_FALSE(reader.contains(7u, traccc::io::event_data_type::cells));
+    EXPECT_FALSE(reader.contains(7u, traccc::io::event_data_type::particles));
+    EXPECT_TRUE(reader.contains(6u, traccc::io::event_data_type::particles));
+    EXPECT_TRUE(reader.particles(6u).empty());
+    EXPECT_THROW(reader.cells(7u), std::out_of_range);
+    for (unsigned int event : {7u, 5u, 6u}) {
+        const traccc::edm::measurement_collection::const_device measurements{
+            reader.measurements(event)};
+        ASSERT_EQ(measurements.size(), event);
+        for (unsigned int i = 0; i < measurements.size(); ++i) {
+            EXPECT_EQ(measurements.cluster_index().at(i), 10u * event + i);
+        }
+    }
+}
+
+TEST(io_event_container, invalid_file) {
+
+    // Write a file that is not in the event container format.
+    const std::filesystem::path filename =
+        std::filesystem::temp_directory_path() / "invalid.trcc";
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file << "This is not an event container file, but it's long enough.";
+    }
+
+    // Make sure that it is rejected.
+    EXPECT_THROW(traccc::io::event_container_reader{filename.native()},
+                 std::runtime_error);
+}
+
+TEST(io_event_container, invalid_index) {
+
+    const traccc::tests::temp_directory temp_dir;
+    const std::filesystem::path filename = temp_dir.path() / "invalid.trcc";
+
+    // Helper writing a file with a given header and index.
+    auto write_file =
+        [&](const traccc::io::details::event_container_header& header,
+            const std::vector<traccc::io::details::event_container_entry>&
+                index) {
+            std::ofstream file(filename, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(index.data()),
+                       static_cast<std::streamsize>(
+                           index.size() * sizeof(index.front())));
+            // Some payload, for the index entries to point at.
+            const std::array<char, 256> payload{};
+            file.write(payload.data(), payload.size());
+        };
+
+    // A number of events that would make the size of the index overflow.
+    traccc::io::details::event_container_header header;
+    header.n_events = std::numeric_limits<std::uint64_t>::max() /
+                          traccc::io::details::n_event_data_types +
+                      1u;
+    write_file(header, std::vector<traccc::io::details::event_container_entry>(
+                           traccc::io::details::n_event_data_types));
+    EXPECT_THROW(traccc::io::event_container_reader{filename.native()},
+                 std::runtime_error);
+
+    // An index entry whose end would overflow.
+    header.n_events = 1u;
+    std::vector<traccc::io::details::event_container_entry> index(
+        traccc::io::details::n_event_data_types);
+    index.front().offset = std::numeric_limits<std::uint64_t>::max() -
+                           traccc::io::details::mapped_soa_alignment + 1u;
+    index.front().size = traccc::io::details::mapped_soa_alignment;
+    write_file(header, index);
+    EXPECT_THROW(traccc::io::event_container_reader{filename.native()},
+                 std::runtime_error);
+
+    // Make sure that a valid index is still accepted.
+    index.front().offset = 2u * traccc::io::details::mapped_soa_alignment;
+    index.front().size = 64u;
+    write_file(header, index);
+    EXPECT_NO_THROW(traccc::io::event_container_reader{filename.native()});
+}
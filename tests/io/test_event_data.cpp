@@ -1,6 +1,6 @@
 /** TRACCC library, part of the ACTS project (R&D line)
  *
- * (c) 2024 CERN for the benefit of the ACTS project
+ * (c) 2024-2026 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -166,8 +166,7 @@ TEST(event_data, mock_data) {
     const auto cells_view = vecmem::get_data(cells);
 
     auto clusters = cc(cells_view, det_cond_data);
-    auto measurements = mc(cells_view, vecmem::get_data(clusters),
-                           det_descr_data, det_cond_data);
+    auto measurements = mc(cells_view, clusters, det_descr_data, det_cond_data);
 
     evt_data.fill_cca_result(cells, clusters, measurements, det_cond);
 
@@ -0,0 +1,181 @@
+/** TRACCC library, part of the ACTS project (R&D line)
+ *
+ * (c) 2026 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "traccc/io/read_cells.hpp"
+#include "traccc/io/read_detector_description.hpp"
+#include "traccc/io/read_measurements.hpp"
+#include "traccc/io/write.hpp"
+
+// Test include(s).
+#include "tests/data_test.hpp"
+#include "tests/temp_directory.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+class io_mapped : public traccc::tests::data_test {};
+
+TEST_F(io_mapped, odd_single_muon_cells) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource mr;
+
+    // Read the ODD detector description.
+    traccc::detector_design_description::host det_desc{mr};
+    traccc::detector_conditions_description::host det_cond{mr};
+    traccc::io::read_detector_description(
+        det_desc, det_cond, "geometries/odd/odd-detray_geometry_detray.json",
+        "geometries/odd/odd-digi-geometric-config.json",
+        "geometries/odd/odd-digi-geometric-config.json");
+
+    // Cell collections to use in the test.
+    traccc::edm::silicon_cell_collection::host orig{mr}, copy{mr};
+
+    // Test the I/O for 10 events.
+    const std::string directory =
+        std::filesystem::temp_directory_path().native();
+    for (std::size_t event = 0; event < 10; ++event) {
+
+        // Read the cells for the current event.
+        traccc::io::read_cells(orig, event, "odd/geant4_1muon_1GeV/",
+                               traccc::getDummyLogger().clone(), &det_cond);
+        // Write the cells into a temporary file.
+        traccc::io::write(event, directory, traccc::data_format::mapped,
+                          vecmem::get_data(orig), vecmem::get_data(det_desc),
+                          vecmem::get_data(det_cond));
+
+        // Read the cells back in, into a host collection.
+        traccc::io::read_cells(copy, event, directory,
+                               traccc::getDummyLogger().clone(), &det_cond,
+                               traccc::data_format::mapped);
+        ASSERT_EQ(orig.size(), copy.size());
+        for (traccc::edm::silicon_cell_collection::host::size_type i = 0;
+             i < orig.size(); ++i) {
+            EXPECT_EQ(orig.at(i), copy.at(i));
+        }
+
+        // Map the cells, and check them through a device object.
+        const auto mapped = traccc::io::map_cells(event, directory);
+        ASSERT_EQ(mapped.size(), orig.size());
+        const traccc::edm::silicon_cell_collection::const_device cells{
+            mapped.view()};
+        for (unsigned int i = 0; i < cells.size(); ++i) {
+            EXPECT_EQ(cells.channel0().at(i), orig.channel0().at(i));
+            EXPECT_EQ(cells.channel1().at(i), orig.channel1().at(i));
+            EXPECT_EQ(cells.activation().at(i), orig.activation().at(i));
+            EXPECT_EQ(cells.time().at(i), orig.time().at(i));
+            EXPECT_EQ(cells.module_index().at(i), orig.module_index().at(i));
+        }
+    }
+}
+
+TEST_F(io_mapped, odd_detector_description) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource mr;
+
+    // Read the ODD detector description from its JSON files.
+    traccc::detector_design_description::host orig_desc{mr};
+    traccc::detector_conditions_description::host orig_cond{mr};
+    traccc::io::read_detector_description(
+        orig_desc, orig_cond, "geometries/odd/odd-detray_geometry_detray.json",
+        "geometries/odd/odd-digi-geometric-config.json",
+        "geometries/odd/odd-digi-geometric-config.json");
+
+    // Write it into a binary file, and read it back.
+    const traccc::tests::temp_directory temp_dir;
+    const std::string filename =
+        (temp_dir.path() / "detector_description.dat").native();
+    traccc::io::write(filename, traccc::data_format::binary,
+                      vecmem::get_data(orig_desc),
+                      vecmem::get_data(orig_cond));
+    traccc::detector_design_description::host copy_desc{mr};
+    traccc::detector_conditions_description::host copy_cond{mr};
+    traccc::io::read_detector_description(copy_desc, copy_cond, filename, "",
+                                          "", traccc::data_format::binary);
+
+    // Compare the two descriptions.
+    ASSERT_EQ(copy_desc.size(), orig_desc.size());
+    EXPECT_EQ(copy_desc.design_id(), orig_desc.design_id());
+    EXPECT_EQ(copy_desc.bin_edges_x(), orig_desc.bin_edges_x());
+    EXPECT_EQ(copy_desc.bin_edges_y(), orig_desc.bin_edges_y());
+    EXPECT_EQ(copy_desc.dimensions(), orig_desc.dimensions());
+    ASSERT_EQ(copy_cond.size(), orig_cond.size());
+    EXPECT_EQ(copy_cond.module_to_design_id(), orig_cond.module_to_design_id());
+    EXPECT_EQ(copy_cond.acts_geometry_id(), orig_cond.acts_geometry_id());
+    for (unsigned int i = 0; i < orig_cond.size(); ++i) {
+        EXPECT_EQ(copy_cond.geometry_id().at(i), orig_cond.geometry_id().at(i));
+    }
+}
+
+TEST(io_mapped, measurements) {
+
+    // Memory resource used by the test.
+    vecmem::host_memory_resource mr;
+
+    // Create a measurement collection with some recognisable values.
+    traccc::edm::measurement_collection::host orig{mr};
+    orig.resize(13u);
+    for (unsigned int i = 0; i < orig.size(); ++i) {
+        orig.local_position().at(i) = {static_cast<float>(i), 2.f};
+        orig.time().at(i) = 0.5f * static_cast<float>(i);
+        orig.subspace().at(i) = {static_cast<std::uint8_t>(i % 2), 1u};
+        orig.cluster_index().at(i) = 100u + i;
+    }
+
+    // Write it out, and map it back in.
+    const std::string directory =
+        std::filesystem::temp_directory_path().native();
+    traccc::io::write(0u, directory, traccc::data_format::mapped,
+                      vecmem::get_data(orig));
+    const auto mapped = traccc::io::map_measurements(0u, directory);
+    ASSERT_EQ(mapped.size(), orig.size());
+
+    // Check the mapped measurements.
+    const traccc::edm::measurement_collection::const_device measurements{
+        mapped.view()};
+    for (unsigned int i = 0; i < measurements.size(); ++i) {
+        EXPECT_EQ(measurements.local_position().at(i),
+                  orig.local_position().at(i));
+        EXPECT_EQ(measurements.time().at(i), orig.time().at(i));
+        EXPECT_EQ(measurements.subspace().at(i), orig.subspace().at(i));
+        EXPECT_EQ(measurements.cluster_index().at(i),
+                  orig.cluster_index().at(i));
+    }
+
+    // Read them into a host collection as well.
+    traccc::edm::measurement_collection::host copy{mr};
+    traccc::io::read_measurements(copy, 0u, directory, nullptr, nullptr,
+                                  nullptr, false, traccc::data_format::mapped);
+    ASSERT_EQ(copy.size(), orig.size());
+    EXPECT_EQ(copy.cluster_index(), orig.cluster_index());
+}
+
+TEST(io_mapped, invalid_file) {
+
+    // Write a file that is not in the mapped format.
+    const std::filesystem::path filename =
+        std::filesystem::temp_directory_path() / "event000000000-cells.soa";
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file << "This is not a mapped SoA file, but it's long enough.";
+    }
+
+    // Make sure that it is rejected.
+    EXPECT_THROW(
+        traccc::io::map_cells(0u, filename.parent_path().native()),
+        std::runtime_error);
+}